@@ -0,0 +1,122 @@
+// Prints the result of every ALU operation for a reproducible stream of
+// random and edge-case operands. alu_diff.sh builds it against two ALU
+// implementations and compares the outputs.
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "simulator/dpu/alu.h"
+
+using upmem_sim::simulator::dpu::ALU;
+
+namespace {
+
+std::mt19937_64 rng(42);
+
+// 32-bit words in both signed and unsigned encodings, with edge values mixed
+// in
+int64_t operand() {
+  static const int64_t edges[] = {0,           1,          -1,
+                                  2,           31,         32,
+                                  33,          63,         0x7F,
+                                  0x80,        0xFF,       0x8000,
+                                  0xFFFF,      0x7FFFFFFE, 0x7FFFFFFF,
+                                  -0x80000000, 0x80000000, 0xFFFFFFFE,
+                                  0xFFFFFFFF};
+  uint64_t random = rng();
+  if (random % 4 == 0) {
+    return edges[(random >> 8) % (sizeof(edges) / sizeof(edges[0]))];
+  }
+
+  auto word = static_cast<uint32_t>(random >> 16);
+  if (random & 2) {
+    return static_cast<int32_t>(word);
+  }
+  return word;
+}
+
+}  // namespace
+
+#define PRINT1(f, ...) \
+  printf(#f " %lld\n", static_cast<long long>(ALU::f(__VA_ARGS__)));
+#define PRINT2(f, ...)                                            \
+  {                                                               \
+    auto [x, y] = ALU::f(__VA_ARGS__);                            \
+    printf(#f " %lld %lld\n", static_cast<long long>(x),          \
+           static_cast<long long>(y));                            \
+  }
+#define PRINT3(f, ...)                                            \
+  {                                                               \
+    auto [x, y, z] = ALU::f(__VA_ARGS__);                         \
+    printf(#f " %lld %d %d\n", static_cast<long long>(x), y, z); \
+  }
+
+int main(int argc, char **argv) {
+  long num_samples = argc > 1 ? atol(argv[1]) : 300000;
+
+  for (long i = 0; i < num_samples; i++) {
+    int64_t a = operand();
+    int64_t b = operand();
+    int64_t shift = static_cast<int64_t>(rng() % 40);
+    bool carry = rng() & 1;
+    printf("in %lld %lld %lld %d\n", static_cast<long long>(a),
+           static_cast<long long>(b), static_cast<long long>(shift), carry);
+
+    PRINT3(add, a, b)
+    PRINT3(addc, a, b, carry)
+    PRINT3(sub, a, b)
+    PRINT3(subc, a, b, carry)
+
+    PRINT1(and_, a, b)
+    PRINT1(nand, a, b)
+    PRINT1(andn, a, b)
+    PRINT1(or_, a, b)
+    PRINT1(nor, a, b)
+    PRINT1(orn, a, b)
+    PRINT1(xor_, a, b)
+    PRINT1(nxor, a, b)
+
+    PRINT1(asr, a, shift)
+    PRINT1(lsl, a, shift)
+    PRINT3(lsl_add, a, b, shift)
+    PRINT3(lsl_sub, a, b, shift)
+    PRINT1(lsl1, a, shift)
+    PRINT1(lslx, a, shift)
+    PRINT1(lsr, a, shift)
+    PRINT3(lsr_add, a, b, shift)
+    PRINT1(lsr1, a, shift)
+    PRINT1(lsrx, a, shift)
+    PRINT1(rol, a, shift)
+    PRINT3(rol_add, a, b, shift)
+    PRINT1(ror, a, shift)
+
+    PRINT1(cao, a)
+    PRINT1(clo, a)
+    PRINT1(cls, a)
+    PRINT1(clz, a)
+    PRINT1(cmpb4, a, b)
+    PRINT1(extsb, a)
+    PRINT1(extsh, a)
+    PRINT1(extub, a)
+    PRINT1(extuh, a)
+
+    PRINT1(mul_sh_sh, a, b)
+    PRINT1(mul_sh_sl, a, b)
+    PRINT1(mul_sh_uh, a, b)
+    PRINT1(mul_sh_ul, a, b)
+    PRINT1(mul_sl_sh, a, b)
+    PRINT1(mul_sl_sl, a, b)
+    PRINT1(mul_sl_uh, a, b)
+    PRINT1(mul_sl_ul, a, b)
+    PRINT1(mul_uh_uh, a, b)
+    PRINT1(mul_uh_ul, a, b)
+    PRINT1(mul_ul_uh, a, b)
+    PRINT1(mul_ul_ul, a, b)
+
+    PRINT1(atomic_address_hash, a & 0x7F, b & 0x7F)
+    PRINT2(signed_extension, a)
+    PRINT2(unsigned_extension, a)
+  }
+  return 0;
+}
@@ -0,0 +1,44 @@
+#!/bin/bash
+
+# Differential test of the ALU: builds alu_diff.cc against the ALU of a
+# reference revision and against the working tree, and compares the results
+# of every operation over the same operands.
+#
+#   ./alu_diff.sh <revision> [num_samples]
+#
+# revision is any git revision whose ALU is trusted, e.g. the commit before
+# an ALU rewrite.
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 <revision> [num_samples]" >&2
+  exit 2
+fi
+revision=$1
+num_samples=${2:-300000}
+
+script_dir=$(cd "$(dirname "$0")" || exit; pwd)
+work_dir=$(mktemp -d)
+trap 'rm -rf "${work_dir}"' EXIT
+
+top_dir=$(git -C "${script_dir}" rev-parse --show-toplevel)
+src_prefix=$(git -C "${script_dir}/../src" rev-parse --show-prefix)
+mkdir -p "${work_dir}/reference/src"
+git -C "${top_dir}" archive "${revision}:${src_prefix}" |
+  tar x -C "${work_dir}/reference/src" || exit
+
+build() {
+  g++ -std=c++20 -O2 -I"$1" "${script_dir}/alu_diff.cc" \
+    "$1/simulator/dpu/alu.cc" "$1/abi/word/_base_word.cc" -o "$2" || exit
+}
+build "${work_dir}/reference/src" "${work_dir}/reference_alu"
+build "${script_dir}/../src" "${work_dir}/alu"
+
+"${work_dir}/reference_alu" "${num_samples}" > "${work_dir}/reference.txt"
+"${work_dir}/alu" "${num_samples}" > "${work_dir}/alu.txt"
+
+if cmp -s "${work_dir}/reference.txt" "${work_dir}/alu.txt"; then
+  echo "ALU matches ${revision} on ${num_samples} operand sets"
+else
+  diff "${work_dir}/reference.txt" "${work_dir}/alu.txt" | head -20
+  exit 1
+fi
@@ -1283,11 +1283,20 @@ simulator::dpu::Thread *Instruction::thread() {
 
 void Instruction::set_thread(simulator::dpu::Thread *thread) {
   assert(thread != nullptr);
-  assert(thread_ == nullptr);
+  assert(thread_ == nullptr or thread_ == thread);
 
   thread_ = thread;
 }
 
+std::set<OpCode> Instruction::merge(
+    std::initializer_list<const std::set<OpCode> *> op_code_sets) {
+  std::set<OpCode> op_codes = {};
+  for (auto &op_code_set : op_code_sets) {
+    op_codes.insert(op_code_set->begin(), op_code_set->end());
+  }
+  return op_codes;
+}
+
 void Instruction::init_rici(reg::SrcReg *ra, int64_t imm,
                             isa::Condition condition, int64_t pc) {
   assert(Instruction::rici_op_codes().count(op_code_));
@@ -1,6 +1,7 @@
 #ifndef UPMEM_SIM_ABI_ISA_INSTRUCTION_INSTRUCTION_H_
 #define UPMEM_SIM_ABI_ISA_INSTRUCTION_INSTRUCTION_H_
 
+#include <initializer_list>
 #include <set>
 
 #include "abi/instruction/op_code.h"
@@ -16,256 +17,302 @@ namespace upmem_sim::abi::instruction {
 
 class Instruction {
  public:
-  static std::set<OpCode> acquire_rici_op_codes() { return {ACQUIRE}; }
-  static std::set<OpCode> release_rici_op_codes() { return {RELEASE}; }
-  static std::set<OpCode> boot_rici_op_codes() { return {BOOT, RESUME}; }
-  static std::set<OpCode> rici_op_codes() {
-    std::set<OpCode> acquire_rici_op_codes =
-        Instruction::acquire_rici_op_codes();
-    std::set<OpCode> release_rici_op_codes =
-        Instruction::release_rici_op_codes();
-    std::set<OpCode> boot_rici_op_codes = Instruction::boot_rici_op_codes();
-
-    std::set<OpCode> rici_op_codes = {};
-    rici_op_codes.insert(acquire_rici_op_codes.begin(),
-                         acquire_rici_op_codes.end());
-    rici_op_codes.insert(release_rici_op_codes.begin(),
-                         release_rici_op_codes.end());
-    rici_op_codes.insert(boot_rici_op_codes.begin(), boot_rici_op_codes.end());
-    return rici_op_codes;
-  }
-
-  static std::set<OpCode> add_rri_op_codes() {
-    return {ADD, ADDC, AND, OR, XOR};
-  }
-  static std::set<OpCode> asr_rri_op_codes() {
-    return {ASR, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
-  }
-  static std::set<OpCode> call_rri_op_codes() { return {CALL}; }
-  static std::set<OpCode> rri_op_codes() {
-    std::set<OpCode> add_rri_op_codes = Instruction::add_rri_op_codes();
-    std::set<OpCode> asr_rri_op_codes = Instruction::asr_rri_op_codes();
-    std::set<OpCode> call_rri_op_codes = Instruction::call_rri_op_codes();
-
-    std::set<OpCode> rri_op_codes = {};
-    rri_op_codes.insert(add_rri_op_codes.begin(), add_rri_op_codes.end());
-    rri_op_codes.insert(asr_rri_op_codes.begin(), asr_rri_op_codes.end());
-    rri_op_codes.insert(call_rri_op_codes.begin(), call_rri_op_codes.end());
-    return rri_op_codes;
-  }
-
-  static std::set<OpCode> add_rric_op_codes() {
-    return {ADD, ADDC, AND, ANDN, NAND, NOR, NXOR, OR, ORN, XOR, HASH};
-  }
-  static std::set<OpCode> asr_rric_op_codes() {
-    return {ASR, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
-  }
-  static std::set<OpCode> sub_rric_op_codes() { return {SUB, SUBC}; }
-  static std::set<OpCode> rric_op_codes() {
-    std::set<OpCode> add_rric_op_codes = Instruction::add_rric_op_codes();
-    std::set<OpCode> asr_rric_op_codes = Instruction::asr_rric_op_codes();
-    std::set<OpCode> sub_rric_op_codes = Instruction::sub_rric_op_codes();
-
-    std::set<OpCode> rric_op_codes = {};
-    rric_op_codes.insert(add_rric_op_codes.begin(), add_rric_op_codes.end());
-    rric_op_codes.insert(asr_rric_op_codes.begin(), asr_rric_op_codes.end());
-    rric_op_codes.insert(sub_rric_op_codes.begin(), sub_rric_op_codes.end());
-    return rric_op_codes;
-  }
-
-  static std::set<OpCode> add_rrici_op_codes() { return {ADD, ADDC}; }
-  static std::set<OpCode> and_rrici_op_codes() {
-    return {AND, ANDN, NAND, NOR, NXOR, OR, ORN, XOR, HASH};
-  }
-  static std::set<OpCode> asr_rrici_op_codes() {
-    return {ASR, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
-  }
-  static std::set<OpCode> sub_rrici_op_codes() { return {SUB, SUBC}; }
-  static std::set<OpCode> rrici_op_codes() {
-    std::set<OpCode> add_rrici_op_codes = Instruction::add_rrici_op_codes();
-    std::set<OpCode> and_rrici_op_codes = Instruction::and_rrici_op_codes();
-    std::set<OpCode> asr_rrici_op_codes = Instruction::asr_rrici_op_codes();
-    std::set<OpCode> sub_rrici_op_codes = Instruction::sub_rrici_op_codes();
-
-    std::set<OpCode> rrici_op_codes = {};
-    rrici_op_codes.insert(add_rrici_op_codes.begin(), add_rrici_op_codes.end());
-    rrici_op_codes.insert(and_rrici_op_codes.begin(), and_rrici_op_codes.end());
-    rrici_op_codes.insert(asr_rrici_op_codes.begin(), asr_rrici_op_codes.end());
-    rrici_op_codes.insert(sub_rrici_op_codes.begin(), sub_rrici_op_codes.end());
-    return rrici_op_codes;
-  }
-
-  static std::set<OpCode> rrif_op_codes() {
-    return {ADD, ADDC, AND, ANDN, NAND, NOR, NXOR,
-            OR,  ORN,  SUB, SUBC, XOR,  HASH};
-  }
-
-  static std::set<OpCode> rrr_op_codes() {
-    return {ADD,       ADDC,      AND,       ANDN,      ASR,       CMPB4,
-            LSL,       LSL1,      LSL1X,     LSLX,      LSR,       LSR1,
-            LSR1X,     LSRX,      MUL_SH_SH, MUL_SH_SL, MUL_SH_UH, MUL_SH_UL,
-            MUL_SL_SH, MUL_SL_SL, MUL_SL_UH, MUL_SL_UL, MUL_UH_UH, MUL_UH_UL,
-            MUL_UL_UH, MUL_UL_UL, NAND,      NOR,       NXOR,      OR,
-            ORN,       ROL,       ROR,       RSUB,      RSUBC,     SUB,
-            SUBC,      XOR,       HASH,      CALL};
-  }
-
-  static std::set<OpCode> add_rrrc_op_codes() {
-    return {ADD,       ADDC,      AND,       ANDN,      ASR,       CMPB4,
-            LSL,       LSL1,      LSL1X,     LSLX,      LSR,       LSR1,
-            LSR1X,     LSRX,      MUL_SH_SH, MUL_SH_SL, MUL_SH_UH, MUL_SH_UL,
-            MUL_SL_SH, MUL_SL_SL, MUL_SL_UH, MUL_SL_UL, MUL_UH_UH, MUL_UH_UL,
-            MUL_UL_UH, MUL_UL_UL, NAND,      NOR,       NXOR,      ROL,
-            ROR,       OR,        ORN,       XOR,       HASH,      CALL};
-  }
-  static std::set<OpCode> rsub_rrrc_op_codes() { return {RSUB, RSUBC}; }
-  static std::set<OpCode> sub_rrrc_op_codes() { return {SUB, SUBC}; }
-  static std::set<OpCode> rrrc_op_codes() {
-    std::set<OpCode> add_rrrc_op_codes = Instruction::add_rrrc_op_codes();
-    std::set<OpCode> rsub_rrrc_op_codes = Instruction::rsub_rrrc_op_codes();
-    std::set<OpCode> sub_rrrc_op_codes = Instruction::sub_rrrc_op_codes();
+  static const std::set<OpCode> &acquire_rici_op_codes() {
+    static const std::set<OpCode> op_codes = {ACQUIRE};
+    return op_codes;
+  }
+  static const std::set<OpCode> &release_rici_op_codes() {
+    static const std::set<OpCode> op_codes = {RELEASE};
+    return op_codes;
+  }
+  static const std::set<OpCode> &boot_rici_op_codes() {
+    static const std::set<OpCode> op_codes = {BOOT, RESUME};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rici_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&acquire_rici_op_codes(), &release_rici_op_codes(),
+               &boot_rici_op_codes()});
+    return op_codes;
+  }
 
-    std::set<OpCode> rrrc_op_codes = {};
-    rrrc_op_codes.insert(add_rrrc_op_codes.begin(), add_rrrc_op_codes.end());
-    rrrc_op_codes.insert(rsub_rrrc_op_codes.begin(), rsub_rrrc_op_codes.end());
-    rrrc_op_codes.insert(sub_rrrc_op_codes.begin(), sub_rrrc_op_codes.end());
-    return rrrc_op_codes;
+  static const std::set<OpCode> &add_rri_op_codes() {
+    static const std::set<OpCode> op_codes = {ADD, ADDC, AND, OR, XOR};
+    return op_codes;
+  }
+  static const std::set<OpCode> &asr_rri_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ASR, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
+    return op_codes;
+  }
+  static const std::set<OpCode> &call_rri_op_codes() {
+    static const std::set<OpCode> op_codes = {CALL};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rri_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&add_rri_op_codes(), &asr_rri_op_codes(), &call_rri_op_codes()});
+    return op_codes;
   }
 
-  static std::set<OpCode> add_rrrci_op_codes() { return {ADD, ADDC}; }
-  static std::set<OpCode> and_rrrci_op_codes() {
-    return {AND, ANDN, NAND, NOR, NXOR, OR, ORN, XOR, HASH};
-  }
-  static std::set<OpCode> asr_rrrci_op_codes() {
-    return {ASR, CMPB4, LSL,   LSL1, LSL1X, LSLX,
-            LSR, LSR1,  LSR1X, LSRX, ROL,   ROR};
-  }
-  static std::set<OpCode> mul_rrrci_op_codes() {
-    return {MUL_SH_SH, MUL_SH_SL, MUL_SH_UH, MUL_SH_UL, MUL_SL_SH, MUL_SL_SL,
-            MUL_SL_UH, MUL_SL_UL, MUL_UH_UH, MUL_UH_UL, MUL_UL_UH, MUL_UL_UL};
+  static const std::set<OpCode> &add_rric_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ADD, ADDC, AND, ANDN, NAND, NOR, NXOR, OR, ORN, XOR, HASH};
+    return op_codes;
+  }
+  static const std::set<OpCode> &asr_rric_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ASR, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
+    return op_codes;
+  }
+  static const std::set<OpCode> &sub_rric_op_codes() {
+    static const std::set<OpCode> op_codes = {SUB, SUBC};
+    return op_codes;
   }
-  static std::set<OpCode> rsub_rrrci_op_codes() {
-    return {RSUB, RSUBC, SUB, SUBC};
+  static const std::set<OpCode> &rric_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&add_rric_op_codes(), &asr_rric_op_codes(),
+               &sub_rric_op_codes()});
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &add_rrici_op_codes() {
+    static const std::set<OpCode> op_codes = {ADD, ADDC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &and_rrici_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        AND, ANDN, NAND, NOR, NXOR, OR, ORN, XOR, HASH};
+    return op_codes;
+  }
+  static const std::set<OpCode> &asr_rrici_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ASR, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
+    return op_codes;
+  }
+  static const std::set<OpCode> &sub_rrici_op_codes() {
+    static const std::set<OpCode> op_codes = {SUB, SUBC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rrici_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&add_rrici_op_codes(), &and_rrici_op_codes(),
+               &asr_rrici_op_codes(), &sub_rrici_op_codes()});
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &rrif_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ADD, ADDC, AND, ANDN, NAND, NOR, NXOR, OR, ORN, SUB, SUBC, XOR, HASH};
+    return op_codes;
   }
-  static std::set<OpCode> rrrci_op_codes() {
-    std::set<OpCode> add_rrrci_op_codes = Instruction::add_rrrci_op_codes();
-    std::set<OpCode> and_rrrci_op_codes = Instruction::and_rrrci_op_codes();
-    std::set<OpCode> asr_rrrci_op_codes = Instruction::asr_rrici_op_codes();
-    std::set<OpCode> mul_rrrci_op_codes = Instruction::mul_rrrci_op_codes();
-    std::set<OpCode> rsub_rrrci_op_codes = Instruction::rsub_rrrci_op_codes();
-
-    std::set<OpCode> rrrci_op_codes = {};
-    rrrci_op_codes.insert(add_rrrci_op_codes.begin(), add_rrrci_op_codes.end());
-    rrrci_op_codes.insert(and_rrrci_op_codes.begin(), and_rrrci_op_codes.end());
-    rrrci_op_codes.insert(asr_rrrci_op_codes.begin(), asr_rrrci_op_codes.end());
-    rrrci_op_codes.insert(mul_rrrci_op_codes.begin(), mul_rrrci_op_codes.end());
-    rrrci_op_codes.insert(rsub_rrrci_op_codes.begin(),
-                          rsub_rrrci_op_codes.end());
-    return rrrci_op_codes;
-  }
-
-  static std::set<OpCode> rr_op_codes() {
-    return {CAO, CLO, CLS, CLZ, EXTSB, EXTSH, EXTUB, EXTUH, SATS, TIME_CFG};
-  }
-
-  static std::set<OpCode> rrc_op_codes() {
-    return {CAO, CLO, CLS, CLZ, EXTSB, EXTSH, EXTUB, EXTUH, SATS};
-  }
-
-  static std::set<OpCode> cao_rrci_op_codes() { return {CAO, CLO, CLS, CLZ}; }
-  static std::set<OpCode> extsb_rrci_op_codes() {
-    return {EXTSB, EXTSH, EXTUB, EXTUH, SATS};
-  }
-  static std::set<OpCode> time_cfg_rrci_op_codes() { return {TIME_CFG}; }
-  static std::set<OpCode> rrci_op_codes() {
-    std::set<OpCode> cao_rrci_op_codes = Instruction::cao_rrci_op_codes();
-    std::set<OpCode> extsb_rrci_op_codes = Instruction::extsb_rrci_op_codes();
-    std::set<OpCode> time_cfg_rrci_op_codes =
-        Instruction::time_cfg_rrci_op_codes();
-
-    std::set<OpCode> rrci_op_codes = {};
-    rrci_op_codes.insert(cao_rrci_op_codes.begin(), cao_rrci_op_codes.end());
-    rrci_op_codes.insert(extsb_rrci_op_codes.begin(),
-                         extsb_rrci_op_codes.end());
-    rrci_op_codes.insert(time_cfg_rrci_op_codes.begin(),
-                         time_cfg_rrci_op_codes.end());
-    return rrci_op_codes;
-  }
-
-  static std::set<OpCode> div_step_drdici_op_codes() { return {DIV_STEP}; }
-  static std::set<OpCode> mul_step_drdici_op_codes() { return {MUL_STEP}; }
-  static std::set<OpCode> drdici_op_codes() {
-    std::set<OpCode> div_step_drdici_op_codes =
-        Instruction::div_step_drdici_op_codes();
-    std::set<OpCode> mul_step_drdici_op_codes =
-        Instruction::mul_step_drdici_op_codes();
-
-    std::set<OpCode> drdici_op_codes = {};
-    drdici_op_codes.insert(div_step_drdici_op_codes.begin(),
-                           div_step_drdici_op_codes.end());
-    drdici_op_codes.insert(mul_step_drdici_op_codes.begin(),
-                           mul_step_drdici_op_codes.end());
-    return drdici_op_codes;
-  }
-
-  static std::set<OpCode> rrri_op_codes() {
-    return {LSL_ADD, LSL_SUB, LSR_ADD, ROL_ADD};
-  }
-  static std::set<OpCode> rrrici_op_codes() {
-    return {LSL_ADD, LSL_SUB, LSR_ADD, ROL_ADD};
-  }
-
-  static std::set<OpCode> rir_op_codes() { return {SUB, SUBC}; }
-  static std::set<OpCode> rirc_op_codes() { return {SUB, SUBC}; }
-  static std::set<OpCode> rirci_op_codes() { return {SUB, SUBC}; }
-
-  static std::set<OpCode> r_op_codes() { return {TIME}; }
-  static std::set<OpCode> rci_op_codes() { return {TIME}; }
 
-  static std::set<OpCode> ci_op_codes() { return {STOP}; }
-  static std::set<OpCode> i_op_codes() { return {FAULT}; }
+  static const std::set<OpCode> &rrr_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ADD, ADDC, AND, ANDN, ASR, CMPB4, LSL, LSL1, LSL1X, LSLX, LSR, LSR1,
+        LSR1X, LSRX, MUL_SH_SH, MUL_SH_SL, MUL_SH_UH, MUL_SH_UL, MUL_SL_SH,
+        MUL_SL_SL, MUL_SL_UH, MUL_SL_UL, MUL_UH_UH, MUL_UH_UL, MUL_UL_UH,
+        MUL_UL_UL, NAND, NOR, NXOR, OR, ORN, ROL, ROR, RSUB, RSUBC, SUB, SUBC,
+        XOR, HASH, CALL};
+    return op_codes;
+  }
 
-  static std::set<OpCode> movd_ddci_op_codes() { return {MOVD}; }
-  static std::set<OpCode> swapd_ddci_op_codes() { return {SWAPD}; }
-  static std::set<OpCode> ddci_op_codes() {
-    std::set<OpCode> movd_ddci_op_codes = Instruction::movd_ddci_op_codes();
-    std::set<OpCode> swapd_ddci_op_codes = Instruction::swapd_ddci_op_codes();
+  static const std::set<OpCode> &add_rrrc_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ADD, ADDC, AND, ANDN, ASR, CMPB4, LSL, LSL1, LSL1X, LSLX, LSR, LSR1,
+        LSR1X, LSRX, MUL_SH_SH, MUL_SH_SL, MUL_SH_UH, MUL_SH_UL, MUL_SL_SH,
+        MUL_SL_SL, MUL_SL_UH, MUL_SL_UL, MUL_UH_UH, MUL_UH_UL, MUL_UL_UH,
+        MUL_UL_UL, NAND, NOR, NXOR, ROL, ROR, OR, ORN, XOR, HASH, CALL};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rsub_rrrc_op_codes() {
+    static const std::set<OpCode> op_codes = {RSUB, RSUBC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &sub_rrrc_op_codes() {
+    static const std::set<OpCode> op_codes = {SUB, SUBC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rrrc_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&add_rrrc_op_codes(), &rsub_rrrc_op_codes(),
+               &sub_rrrc_op_codes()});
+    return op_codes;
+  }
 
-    std::set<OpCode> ddci_op_codes = {};
-    ddci_op_codes.insert(movd_ddci_op_codes.begin(), movd_ddci_op_codes.end());
-    ddci_op_codes.insert(swapd_ddci_op_codes.begin(),
-                         swapd_ddci_op_codes.end());
-    return ddci_op_codes;
-  }
+  static const std::set<OpCode> &add_rrrci_op_codes() {
+    static const std::set<OpCode> op_codes = {ADD, ADDC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &and_rrrci_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        AND, ANDN, NAND, NOR, NXOR, OR, ORN, XOR, HASH};
+    return op_codes;
+  }
+  static const std::set<OpCode> &asr_rrrci_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        ASR, CMPB4, LSL, LSL1, LSL1X, LSLX, LSR, LSR1, LSR1X, LSRX, ROL, ROR};
+    return op_codes;
+  }
+  static const std::set<OpCode> &mul_rrrci_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        MUL_SH_SH, MUL_SH_SL, MUL_SH_UH, MUL_SH_UL, MUL_SL_SH, MUL_SL_SL,
+        MUL_SL_UH, MUL_SL_UL, MUL_UH_UH, MUL_UH_UL, MUL_UL_UH, MUL_UL_UL};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rsub_rrrci_op_codes() {
+    static const std::set<OpCode> op_codes = {RSUB, RSUBC, SUB, SUBC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rrrci_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&add_rrrci_op_codes(), &and_rrrci_op_codes(),
+               &asr_rrici_op_codes(), &mul_rrrci_op_codes(),
+               &rsub_rrrci_op_codes()});
+    return op_codes;
+  }
 
-  static std::set<OpCode> erri_op_codes() { return {LBS, LBU, LHS, LHU, LW}; }
-  static std::set<OpCode> edri_op_codes() { return {LD}; }
-
-  static std::set<OpCode> erii_op_codes() {
-    return {SB, SB_ID, SD, SD_ID, SH, SH_ID, SW, SW_ID, SD, SD_ID};
+  static const std::set<OpCode> &rr_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        CAO, CLO, CLS, CLZ, EXTSB, EXTSH, EXTUB, EXTUH, SATS, TIME_CFG};
+    return op_codes;
   }
-  static std::set<OpCode> erir_op_codes() { return {SB, SH, SW}; }
-  static std::set<OpCode> erid_op_codes() { return {SD}; }
 
-  static std::set<OpCode> ldma_dma_rri_op_codes() { return {LDMA}; }
-  static std::set<OpCode> ldmai_dma_rri_op_codes() { return {LDMAI}; }
-  static std::set<OpCode> sdma_dma_rri_op_codes() { return {SDMA}; }
-  static std::set<OpCode> dma_rri_op_codes() {
-    std::set<OpCode> ldma_dma_rri_op_codes =
-        Instruction::ldma_dma_rri_op_codes();
-    std::set<OpCode> ldmai_dma_rri_op_codes =
-        Instruction::ldmai_dma_rri_op_codes();
-    std::set<OpCode> sdma_dma_rri_op_codes =
-        Instruction::sdma_dma_rri_op_codes();
+  static const std::set<OpCode> &rrc_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        CAO, CLO, CLS, CLZ, EXTSB, EXTSH, EXTUB, EXTUH, SATS};
+    return op_codes;
+  }
 
-    std::set<OpCode> dma_rri_op_codes = {};
-    dma_rri_op_codes.insert(ldma_dma_rri_op_codes.begin(),
-                            ldma_dma_rri_op_codes.end());
-    dma_rri_op_codes.insert(ldmai_dma_rri_op_codes.begin(),
-                            ldmai_dma_rri_op_codes.end());
-    dma_rri_op_codes.insert(sdma_dma_rri_op_codes.begin(),
-                            sdma_dma_rri_op_codes.end());
-    return dma_rri_op_codes;
+  static const std::set<OpCode> &cao_rrci_op_codes() {
+    static const std::set<OpCode> op_codes = {CAO, CLO, CLS, CLZ};
+    return op_codes;
+  }
+  static const std::set<OpCode> &extsb_rrci_op_codes() {
+    static const std::set<OpCode> op_codes = {EXTSB, EXTSH, EXTUB, EXTUH, SATS};
+    return op_codes;
+  }
+  static const std::set<OpCode> &time_cfg_rrci_op_codes() {
+    static const std::set<OpCode> op_codes = {TIME_CFG};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rrci_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&cao_rrci_op_codes(), &extsb_rrci_op_codes(),
+               &time_cfg_rrci_op_codes()});
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &div_step_drdici_op_codes() {
+    static const std::set<OpCode> op_codes = {DIV_STEP};
+    return op_codes;
+  }
+  static const std::set<OpCode> &mul_step_drdici_op_codes() {
+    static const std::set<OpCode> op_codes = {MUL_STEP};
+    return op_codes;
+  }
+  static const std::set<OpCode> &drdici_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&div_step_drdici_op_codes(), &mul_step_drdici_op_codes()});
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &rrri_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        LSL_ADD, LSL_SUB, LSR_ADD, ROL_ADD};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rrrici_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        LSL_ADD, LSL_SUB, LSR_ADD, ROL_ADD};
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &rir_op_codes() {
+    static const std::set<OpCode> op_codes = {SUB, SUBC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rirc_op_codes() {
+    static const std::set<OpCode> op_codes = {SUB, SUBC};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rirci_op_codes() {
+    static const std::set<OpCode> op_codes = {SUB, SUBC};
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &r_op_codes() {
+    static const std::set<OpCode> op_codes = {TIME};
+    return op_codes;
+  }
+  static const std::set<OpCode> &rci_op_codes() {
+    static const std::set<OpCode> op_codes = {TIME};
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &ci_op_codes() {
+    static const std::set<OpCode> op_codes = {STOP};
+    return op_codes;
+  }
+  static const std::set<OpCode> &i_op_codes() {
+    static const std::set<OpCode> op_codes = {FAULT};
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &movd_ddci_op_codes() {
+    static const std::set<OpCode> op_codes = {MOVD};
+    return op_codes;
+  }
+  static const std::set<OpCode> &swapd_ddci_op_codes() {
+    static const std::set<OpCode> op_codes = {SWAPD};
+    return op_codes;
+  }
+  static const std::set<OpCode> &ddci_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&movd_ddci_op_codes(), &swapd_ddci_op_codes()});
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &erri_op_codes() {
+    static const std::set<OpCode> op_codes = {LBS, LBU, LHS, LHU, LW};
+    return op_codes;
+  }
+  static const std::set<OpCode> &edri_op_codes() {
+    static const std::set<OpCode> op_codes = {LD};
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &erii_op_codes() {
+    static const std::set<OpCode> op_codes = {
+        SB, SB_ID, SD, SD_ID, SH, SH_ID, SW, SW_ID, SD, SD_ID};
+    return op_codes;
+  }
+  static const std::set<OpCode> &erir_op_codes() {
+    static const std::set<OpCode> op_codes = {SB, SH, SW};
+    return op_codes;
+  }
+  static const std::set<OpCode> &erid_op_codes() {
+    static const std::set<OpCode> op_codes = {SD};
+    return op_codes;
+  }
+
+  static const std::set<OpCode> &ldma_dma_rri_op_codes() {
+    static const std::set<OpCode> op_codes = {LDMA};
+    return op_codes;
+  }
+  static const std::set<OpCode> &ldmai_dma_rri_op_codes() {
+    static const std::set<OpCode> op_codes = {LDMAI};
+    return op_codes;
+  }
+  static const std::set<OpCode> &sdma_dma_rri_op_codes() {
+    static const std::set<OpCode> op_codes = {SDMA};
+    return op_codes;
+  }
+  static const std::set<OpCode> &dma_rri_op_codes() {
+    static const std::set<OpCode> op_codes =
+        merge({&ldma_dma_rri_op_codes(), &ldmai_dma_rri_op_codes(),
+               &sdma_dma_rri_op_codes()});
+    return op_codes;
   }
 
   explicit Instruction(OpCode op_code, Suffix suffix, reg::SrcReg *ra,
@@ -402,6 +449,14 @@ class Instruction {
 
   abi::word::Immediate *imm();
   abi::word::Immediate *off();
+
+  bool has_rc() { return rc_ != nullptr; }
+  bool has_ra() { return ra_ != nullptr; }
+  bool has_rb() { return rb_ != nullptr; }
+  bool has_dc() { return dc_ != nullptr; }
+  bool has_imm() { return imm_ != nullptr; }
+  bool has_off() { return off_ != nullptr; }
+  bool has_pc() { return pc_ != nullptr; }
   abi::word::Immediate *pc();
   isa::Endian endian();
 
@@ -409,6 +464,9 @@ class Instruction {
   void set_thread(simulator::dpu::Thread *thread);
 
  protected:
+  static std::set<OpCode> merge(
+      std::initializer_list<const std::set<OpCode> *> op_code_sets);
+
   void init_rici(reg::SrcReg *ra, int64_t imm, isa::Condition condition,
                  int64_t pc);
   void init_rri(reg::GPReg *rc, reg::SrcReg *ra, int64_t imm);
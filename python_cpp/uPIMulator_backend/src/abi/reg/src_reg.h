@@ -9,8 +9,13 @@ namespace upmem_sim::abi::reg {
 class SrcReg {
  public:
   explicit SrcReg(GPReg *reg)
-      : gp_reg_(new GPReg(reg->index())), sp_reg_(nullptr) {}
-  explicit SrcReg(SPReg *reg) : gp_reg_(nullptr), sp_reg_(new SPReg(*reg)) {}
+      : gp_reg_(new GPReg(reg->index())),
+        sp_reg_(nullptr),
+        index_(reg->index()) {}
+  explicit SrcReg(SPReg *reg)
+      : gp_reg_(nullptr),
+        sp_reg_(new SPReg(*reg)),
+        index_(util::ConfigLoader::num_gp_registers() + *reg) {}
   ~SrcReg();
 
   bool is_gp_reg() { return gp_reg_ != nullptr; }
@@ -19,9 +24,13 @@ class SrcReg {
   GPReg *gp_reg();
   SPReg *sp_reg();
 
+  // GP registers first, then the special registers in SPReg order
+  RegIndex index() { return index_; }
+
  private:
   GPReg *gp_reg_;
   SPReg *sp_reg_;
+  RegIndex index_;
 };
 
 }  // namespace upmem_sim::abi::reg
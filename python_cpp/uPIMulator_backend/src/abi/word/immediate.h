@@ -14,6 +14,7 @@ class Immediate {
   Immediate(Representation representation, int width, int64_t value)
       : representation_(representation), word_(new _BaseWord(width)) {
     word_->set_value(value);
+    value_ = word_->value(representation_);
   }
   ~Immediate() { delete word_; }
 
@@ -24,12 +25,14 @@ class Immediate {
   int64_t bit_slice(int begin, int end) {
     return word_->bit_slice(representation_, begin, end);
   }
-  int64_t value() { return word_->value(representation_); }
+  int64_t value() { return value_; }
   encoder::ByteStream *to_byte_stream() { return word_->to_byte_stream(); }
 
  private:
   Representation representation_;
   _BaseWord *word_;
+  // immediates never change after decoding
+  int64_t value_;
 };
 
 }  // namespace upmem_sim::abi::word
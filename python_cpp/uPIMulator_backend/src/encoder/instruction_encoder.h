@@ -234,17 +234,21 @@ class InstructionEncoder {
   static int suffix_end() { return suffix_begin() + suffix_width(); }
 
   static int op_code_width() {
-    return ceil(log2(1.0 + abi::instruction::SDMA));
+    return ceil(log2(1.0 + static_cast<int>(abi::instruction::SDMA)));
   }
   static int suffix_width() {
-    return ceil(log2(1.0 + abi::instruction::DMA_RRI));
+    return ceil(log2(1.0 + static_cast<int>(abi::instruction::DMA_RRI)));
   }
   static int register_width() {
     return ceil(log2(util::ConfigLoader::num_gp_registers() + abi::reg::ID8));
   }
-  static int condition_width() { return ceil(log2(1.0 + abi::isa::LARGE)); }
+  static int condition_width() {
+    return ceil(log2(1.0 + static_cast<int>(abi::isa::LARGE)));
+  }
   static int pc_width() { return util::ConfigLoader::iram_address_width(); }
-  static int endian_width() { return ceil(log2(1.0 + abi::isa::BIG)); }
+  static int endian_width() {
+    return ceil(log2(1.0 + static_cast<int>(abi::isa::BIG)));
+  }
 };
 
 }  // namespace upmem_sim::encoder
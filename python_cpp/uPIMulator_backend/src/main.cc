@@ -1,6 +1,9 @@
+#include <fstream>
 #include <iostream>
 
+#include "simulator/dram/memory_replay.h"
 #include "simulator/system.h"
+#include "translator/block_translator.h"
 #include "util/argument_parser.h"
 
 namespace upmem_sim {
@@ -13,11 +16,71 @@ util::ArgumentParser *init_argument_parser() {
   // level 1: level 0 + prints UPMEM instruction executed per each logic cycle
   // level 2: level + prints UPMEM register file values per each logic cycle
   argument_parser->add_option("verbose", util::ArgumentParser::INT, "0");
+  // binary instruction trace (see tracer/trace_record.h); empty disables it
+  argument_parser->add_option("trace", util::ArgumentParser::STRING, "");
+  // gzip CSV of DMA, row buffer, WRAM and lock events; empty disables it
+  argument_parser->add_option("access_log", util::ArgumentParser::STRING, "");
+  // gzip CSV of the DMACommands entering and leaving each memory controller;
+  // memory_replay runs one through the memory controllers alone, under the
+  // current timing and scheduling options, and exits
+  argument_parser->add_option("memory_trace", util::ArgumentParser::STRING,
+                              "");
+  argument_parser->add_option("memory_replay", util::ArgumentParser::STRING,
+                              "");
+  // counts rank cycles in which every issuing DPU issued the same tasklet at
+  // the same pc (Rank lockstep_cycle, lockstep_issues, diverged_cycle); an
+  // analysis of how often grouped execution could apply, nothing is grouped
+  argument_parser->add_option("lockstep_profile", util::ArgumentParser::INT,
+                              "0");
+  // host time per simulator component; interval reports go to stderr every
+  // N simulated cycles (0 reports only at the end)
+  argument_parser->add_option("host_profile", util::ArgumentParser::INT, "0");
+  argument_parser->add_option("host_profile_interval",
+                              util::ArgumentParser::INT, "0");
+  // every N simulated cycles, the change of each stat is appended to the
+  // stats_series CSV (0 disables it)
+  argument_parser->add_option("stats_interval", util::ArgumentParser::INT,
+                              "0");
+  argument_parser->add_option("stats_series", util::ArgumentParser::STRING,
+                              "stats_series.csv");
+  // text keeps the flat "stat: value" lines; json, csv and binary write the
+  // per-rank/DPU/tasklet tree to stats_path (stdout if empty, except binary)
+  argument_parser->add_option("stats_format", util::ArgumentParser::STRING,
+                              "text");
+  argument_parser->add_option("stats_path", util::ArgumentParser::STRING, "");
+  // writes the benchmark's IRAM image as C++ basic blocks to this path and
+  // exits without simulating; empty disables it
+  argument_parser->add_option("translate", util::ArgumentParser::STRING, "");
+  // shared library built from --translate output; its basic blocks replace
+  // the interpreter for the arithmetic they cover, timing is unchanged;
+  // ignored at verbose 2 so register dumps stay per instruction
+  argument_parser->add_option("translated_blocks",
+                              util::ArgumentParser::STRING, "");
+  // once every tasklet's issue repeats with a period (failed acquires and
+  // arithmetic only, e.g. while the lock holder waits on a DMA), whole periods
+  // are advanced at once until a DMA completes; stats are unchanged. Off under
+  // verbose, probes, traces and interval reports
+  argument_parser->add_option("spin_fast_forward", util::ArgumentParser::INT,
+                              "1");
 
   argument_parser->add_option("benchmark", util::ArgumentParser::STRING, "TRNS");
   argument_parser->add_option("num_dpus", util::ArgumentParser::INT, "1");
   argument_parser->add_option("num_tasklets", util::ArgumentParser::INT, "16");
 
+  argument_parser->add_option("num_dpus_per_rank", util::ArgumentParser::INT,
+                              "64");
+  argument_parser->add_option("num_dpus_per_chip", util::ArgumentParser::INT,
+                              "8");
+  argument_parser->add_option("num_host_threads", util::ArgumentParser::INT,
+                              "1");
+  // rank cycles each host thread runs between barriers
+  argument_parser->add_option("host_quantum", util::ArgumentParser::INT,
+                              "1024");
+  argument_parser->add_option("host_model", util::ArgumentParser::STRING,
+                              "sync");
+  argument_parser->add_option("host_script", util::ArgumentParser::STRING,
+                              "host_commands");
+
   argument_parser->add_option("bindir", util::ArgumentParser::STRING,
                               "/home/via/uPIMulator_frontend/bin");
   argument_parser->add_option("logdir", util::ArgumentParser::STRING,
@@ -55,9 +118,76 @@ util::ArgumentParser *init_argument_parser() {
   argument_parser->add_option("rank_write_bandwidth", util::ArgumentParser::INT,
                               "3"); //3
 
+  argument_parser->add_option("rank_transfer_model",
+                              util::ArgumentParser::STRING, "per_dpu");
+  argument_parser->add_option("rank_bus_width", util::ArgumentParser::INT,
+                              "64");  // 8 bits per chip
+  argument_parser->add_option("rank_burst_length", util::ArgumentParser::INT,
+                              "8");  // based on DDR4-2400
+
   return argument_parser;
 }
 
+// checked before simulating so that a bad value does not cost a full run
+bool check_stats_format(util::ArgumentParser *argument_parser) {
+  std::string stats_format =
+      argument_parser->get_string_parameter("stats_format");
+  if (stats_format != "text" and stats_format != "json" and
+      stats_format != "csv" and stats_format != "binary") {
+    std::cerr << "unknown stats_format: " << stats_format
+              << " (text, json, csv or binary)" << std::endl;
+    return false;
+  }
+
+  if (stats_format == "binary" and
+      argument_parser->get_string_parameter("stats_path").empty()) {
+    std::cerr << "stats_format binary needs a stats_path" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int translate(util::ArgumentParser *argument_parser) {
+  std::string iram_filepath =
+      argument_parser->get_string_parameter("bindir") + "/" +
+      argument_parser->get_string_parameter("benchmark") + "." +
+      std::to_string(argument_parser->get_int_parameter("num_tasklets")) +
+      "/iram.bin";
+  auto iram_byte_stream = new encoder::ByteStream(iram_filepath);
+  auto block_translator = new translator::BlockTranslator(iram_byte_stream);
+
+  std::ofstream ofs(argument_parser->get_string_parameter("translate"));
+  if (not ofs) {
+    throw std::invalid_argument("");
+  }
+  block_translator->write(ofs, iram_filepath);
+
+  std::cout << "translated_blocks: " << block_translator->num_blocks()
+            << std::endl;
+  std::cout << "translated_instructions: "
+            << block_translator->num_translated_instructions() << std::endl;
+  std::cout << "num_instructions: " << block_translator->num_instructions()
+            << std::endl;
+
+  delete block_translator;
+  delete iram_byte_stream;
+  return 0;
+}
+
+int replay(util::ArgumentParser *argument_parser) {
+  auto memory_replay = new simulator::dram::MemoryReplay(argument_parser);
+  memory_replay->run();
+
+  util::StatFactory *stat_factory = memory_replay->stat_factory();
+  for (auto &stat : stat_factory->stats()) {
+    std::cout << stat << ": " << stat_factory->value(stat) << std::endl;
+  }
+
+  delete stat_factory;
+  delete memory_replay;
+  return 0;
+}
+
 }  // namespace upmem_sim
 
 int main(int argc, char **argv) {
@@ -65,6 +195,17 @@ int main(int argc, char **argv) {
       upmem_sim::init_argument_parser();
   argument_parser->parse(argc, argv);
 
+  if (not upmem_sim::check_stats_format(argument_parser)) {
+    return 1;
+  }
+
+  if (not argument_parser->get_string_parameter("translate").empty()) {
+    return upmem_sim::translate(argument_parser);
+  }
+  if (not argument_parser->get_string_parameter("memory_replay").empty()) {
+    return upmem_sim::replay(argument_parser);
+  }
+
   auto system = new upmem_sim::simulator::System(argument_parser);
   system->init();
   while (not system->is_finished()) {
@@ -85,12 +226,44 @@ int main(int argc, char **argv) {
       throw std::invalid_argument("");
     }
   }
+  std::cout << "hardware_profile: "
+            << upmem_sim::util::ConfigLoader::profile().name << std::endl;
 
-  upmem_sim::util::StatFactory *system_stat_factory = system->stat_factory();
-  for (auto &stat : system_stat_factory->stats()) {
-      std::cout << stat << ": " << system_stat_factory->value(stat) << std::endl;
+  std::string stats_format =
+      argument_parser->get_string_parameter("stats_format");
+  if (stats_format == "text") {
+    upmem_sim::util::StatFactory *system_stat_factory =
+        system->stat_factory();
+    for (auto &stat : system_stat_factory->stats()) {
+      std::cout << stat << ": " << system_stat_factory->value(stat)
+                << std::endl;
+    }
+    delete system_stat_factory;
+  } else {
+    std::string stats_path =
+        argument_parser->get_string_parameter("stats_path");
+    std::ofstream ofs;
+    if (not stats_path.empty()) {
+      ofs.open(stats_path, std::ios::binary);
+    } else if (stats_format == "binary") {
+      throw std::invalid_argument("");
+    }
+    std::ostream &os = stats_path.empty() ? std::cout : ofs;
+
+    upmem_sim::util::StatTree *system_stat_tree = system->stat_tree();
+    if (stats_format == "json") {
+      system_stat_tree->write_json(os);
+    } else if (stats_format == "csv") {
+      system_stat_tree->write_csv(os);
+    } else if (stats_format == "binary") {
+      system_stat_tree->write_binary(os);
+    } else {
+      throw std::invalid_argument("");
+    }
+    delete system_stat_tree;
   }
-  delete system_stat_factory;
+
+  system->report_host_profile(std::cout);
 
   delete argument_parser;
   delete system;
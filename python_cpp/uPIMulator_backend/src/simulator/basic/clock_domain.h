@@ -0,0 +1,61 @@
+#ifndef UPMEM_SIM_SIMULATOR_BASIC_CLOCK_DOMAIN_H_
+#define UPMEM_SIM_SIMULATOR_BASIC_CLOCK_DOMAIN_H_
+
+#include <cassert>
+#include <numeric>
+
+#include "main.h"
+
+namespace upmem_sim::simulator::basic {
+
+// A clock stepped once per cycle of a slower or faster reference clock. The
+// frequency ratio is kept as a reduced fraction, so reference cycle n carries
+// exactly the edges in (n - 1, n] reference periods, floor(n * ratio) -
+// floor((n - 1) * ratio), with no rounding drift however long the run.
+class ClockDomain {
+ public:
+  explicit ClockDomain(int64_t frequency, int64_t reference_frequency)
+      : numerator_(frequency / std::gcd(frequency, reference_frequency)),
+        denominator_(reference_frequency /
+                     std::gcd(frequency, reference_frequency)),
+        reference_cycle_(0),
+        cycle_(0) {
+    assert(frequency > 0);
+    assert(reference_frequency > 0);
+
+    // floor(-ratio), the edge count at reference cycle -1
+    edge_ = -((numerator_ + denominator_ - 1) / denominator_);
+  }
+  ~ClockDomain() = default;
+
+  SimTime reference_cycle() { return reference_cycle_; }
+  SimTime cycle() { return cycle_; }
+
+  // advances one reference cycle and returns the edges of this clock in it
+  int tick() { return static_cast<int>(tick(1)); }
+
+  // advances num_cycles reference cycles at once
+  SimTime tick(SimTime num_cycles) {
+    assert(num_cycles > 0);
+
+    reference_cycle_ += num_cycles;
+    SimTime edge = (reference_cycle_ - 1) * numerator_ / denominator_;
+    SimTime num_edges = edge - edge_;
+
+    edge_ = edge;
+    cycle_ += num_edges;
+    return num_edges;
+  }
+
+ private:
+  int64_t numerator_;
+  int64_t denominator_;
+
+  SimTime reference_cycle_;
+  SimTime cycle_;
+  SimTime edge_;
+};
+
+}  // namespace upmem_sim::simulator::basic
+
+#endif
@@ -4,6 +4,7 @@
 #include <cassert>
 #include <iostream>
 #include <queue>
+#include <vector>
 
 namespace upmem_sim::simulator::basic {
 
@@ -24,6 +25,8 @@ class Queue {
   void cycle() = delete;
 
   T *front();
+  // front to back
+  std::vector<T *> items();
 
  private:
   int size_;
@@ -64,6 +67,15 @@ T *Queue<T>::front() {
   }
 }
 
+template <typename T>
+std::vector<T *> Queue<T>::items() {
+  std::vector<T *> items;
+  for (std::queue<T *> q = q_; not q.empty(); q.pop()) {
+    items.push_back(q.front());
+  }
+  return items;
+}
+
 }  // namespace upmem_sim::simulator::basic
 
 #endif
@@ -28,6 +28,8 @@ class TimerQueue {
   void cycle();
 
   std::tuple<T *, int> front();
+  // front to back, with the cycles each item still waits
+  const std::vector<std::tuple<T *, int>> &items() { return q_; }
 
  private:
   int size_;
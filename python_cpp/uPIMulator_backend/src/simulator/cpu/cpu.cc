@@ -2,16 +2,94 @@
 
 namespace upmem_sim::simulator::cpu {
 
+CPU::CPU(util::ArgumentParser* argument_parser)
+    : host_model_(argument_parser->get_string_parameter("host_model")),
+      topology_(nullptr),
+      payload_archive_(new PayloadArchive(argument_parser)),
+      init_thread_(new InitThread(argument_parser)),
+      sched_thread_(new SchedThread(argument_parser)),
+      fini_thread_(new FiniThread(argument_parser)),
+      pipeline_thread_(new PipelineThread(argument_parser)),
+      script_thread_(new ScriptThread(argument_parser)) {
+  if (host_model_ != "sync" and host_model_ != "async" and
+      host_model_ != "script") {
+    throw std::invalid_argument("");
+  }
+
+  pipeline_thread_->connect_init_thread(init_thread_);
+  pipeline_thread_->connect_sched_thread(sched_thread_);
+  script_thread_->connect_init_thread(init_thread_);
+
+  sched_thread_->connect_payload_archive(payload_archive_);
+  script_thread_->connect_payload_archive(payload_archive_);
+}
+
 CPU::~CPU() {
   delete init_thread_;
   delete sched_thread_;
   delete fini_thread_;
+  delete pipeline_thread_;
+  delete script_thread_;
+
+  delete payload_archive_;
+}
+
+void CPU::connect_topology(rank::Topology* topology) {
+  assert(topology != nullptr);
+  assert(topology_ == nullptr);
+
+  topology_ = topology;
+  init_thread_->connect_topology(topology);
+  sched_thread_->connect_topology(topology);
+  fini_thread_->connect_topology(topology);
+  pipeline_thread_->connect_topology(topology);
+  script_thread_->connect_topology(topology);
 }
 
 void CPU::connect_rank(rank::Rank* rank) {
   init_thread_->connect_rank(rank);
   sched_thread_->connect_rank(rank);
   fini_thread_->connect_rank(rank);
+  pipeline_thread_->connect_rank(rank);
+  script_thread_->connect_rank(rank);
+}
+
+bool CPU::is_finished() {
+  if (host_model_ == "script") {
+    return script_thread_->is_finished();
+  } else {
+    return pipeline_thread_->is_finished();
+  }
+}
+
+bool CPU::is_finished(rank::Rank* rank) {
+  if (host_model_ == "script") {
+    return script_thread_->is_finished();
+  } else {
+    return pipeline_thread_->is_finished(rank);
+  }
+}
+
+void CPU::launch() {
+  init_thread_->launch();
+
+  if (host_model_ == "async") {
+    pipeline_thread_->launch();
+  }
+}
+
+void CPU::cycle() {
+  if (host_model_ == "script") {
+    script_thread_->cycle();
+  }
+}
+
+void CPU::cycle(rank::Rank* rank) {
+  fini_thread_->cycle(rank);
+
+  if (host_model_ == "async") {
+    pipeline_thread_->cycle(rank);
+  }
 }
 
 }  // namespace upmem_sim::simulator::cpu
@@ -3,34 +3,46 @@
 
 #include "simulator/cpu/fini_thread.h"
 #include "simulator/cpu/init_thread.h"
+#include "simulator/cpu/payload_archive.h"
+#include "simulator/cpu/pipeline_thread.h"
 #include "simulator/cpu/sched_thread.h"
+#include "simulator/cpu/script_thread.h"
 #include "simulator/rank/rank.h"
 
 namespace upmem_sim::simulator::cpu {
 
 class CPU {
  public:
-  explicit CPU(util::ArgumentParser *argument_parser)
-      : init_thread_(new InitThread(argument_parser)),
-        sched_thread_(new SchedThread(argument_parser)),
-        fini_thread_(new FiniThread(argument_parser)) {}
+  explicit CPU(util::ArgumentParser *argument_parser);
   ~CPU();
 
+  void connect_topology(rank::Topology *topology);
   void connect_rank(rank::Rank *rank);
 
   int num_executions() { return fini_thread_->num_executions(); }
 
+  bool is_finished();
+  bool is_finished(rank::Rank *rank);
+
   void init() { init_thread_->init(); }
-  void launch() { init_thread_->launch(); }
+  void launch();
   void sched(int execution) { sched_thread_->sched(execution); }
   void check(int execution) { sched_thread_->check(execution); }
   void fini() {}
-  void cycle() { fini_thread_->cycle(); }
+  void cycle();
+  void cycle(rank::Rank *rank);
 
  private:
+  std::string host_model_;
+
+  rank::Topology *topology_;
+  PayloadArchive *payload_archive_;
+
   InitThread *init_thread_;
   SchedThread *sched_thread_;
   FiniThread *fini_thread_;
+  PipelineThread *pipeline_thread_;
+  ScriptThread *script_thread_;
 };
 
 }  // namespace upmem_sim::simulator::cpu
@@ -2,15 +2,14 @@
 
 namespace upmem_sim::simulator::cpu {
 
-void FiniThread::connect_rank(rank::Rank *rank) {
-  assert(rank != nullptr);
-  assert(rank_ == nullptr);
-
-  rank_ = rank;
+void FiniThread::cycle() {
+  for (auto &rank : ranks()) {
+    cycle(rank);
+  }
 }
 
-void FiniThread::cycle() {
-  for (auto &dpu : rank_->dpus()) {
+void FiniThread::cycle(rank::Rank *rank) {
+  for (auto &dpu : rank->dpus()) {
     for (auto &thread : dpu->scheduler()->threads()) {
       if (thread->reg_file()->read_pc_reg() == sys_end_pointer() and
           thread->state() == dpu::Thread::SLEEP) {
@@ -9,17 +9,13 @@ namespace upmem_sim::simulator::cpu {
 class FiniThread : public Thread {
  public:
   explicit FiniThread(util::ArgumentParser *argument_parser)
-      : Thread(argument_parser), rank_(nullptr) {}
+      : Thread(argument_parser) {}
   ~FiniThread() = default;
 
-  void connect_rank(rank::Rank *rank);
-
   void fini() = delete;
 
   void cycle();
-
- private:
-  rank::Rank *rank_;
+  void cycle(rank::Rank *rank);
 };
 
 }  // namespace upmem_sim::simulator::cpu
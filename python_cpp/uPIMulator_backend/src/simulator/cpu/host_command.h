@@ -0,0 +1,41 @@
+#ifndef UPMEM_SIM_SIMULATOR_CPU_HOST_COMMAND_H_
+#define UPMEM_SIM_SIMULATOR_CPU_HOST_COMMAND_H_
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace upmem_sim::simulator::cpu {
+
+class HostCommand {
+ public:
+  enum Kind { LOAD = 0, XFER_TO, XFER_FROM, COMPARE, LAUNCH, WAIT, LOOP, END };
+
+  explicit HostCommand(Kind kind, std::vector<std::string> operands)
+      : kind_(kind), operands_(std::move(operands)), jump_(-1) {}
+  ~HostCommand() = default;
+
+  Kind kind() { return kind_; }
+
+  int num_operands() { return static_cast<int>(operands_.size()); }
+  std::string operand(int index) {
+    assert(0 <= index and index < operands_.size());
+    return operands_[index];
+  }
+
+  // pc of the matching end (for loop) or loop (for end)
+  int jump() { return jump_; }
+  void set_jump(int jump) {
+    assert(jump_ == -1);
+    jump_ = jump;
+  }
+
+ private:
+  Kind kind_;
+  std::vector<std::string> operands_;
+  int jump_;
+};
+
+}  // namespace upmem_sim::simulator::cpu
+
+#endif
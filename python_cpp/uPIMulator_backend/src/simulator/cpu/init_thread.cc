@@ -4,14 +4,16 @@
 
 namespace upmem_sim::simulator::cpu {
 
-void InitThread::connect_rank(rank::Rank *rank) {
-  assert(rank != nullptr);
-  assert(rank_ == nullptr);
-
-  rank_ = rank;
+InitThread::~InitThread() {
+  delete atomic_byte_stream_;
+  delete iram_byte_stream_;
+  delete wram_byte_stream_;
+  delete mram_byte_stream_;
 }
 
 void InitThread::init() {
+  load_images();
+
   dma_transfer_to_atomic();
   dma_transfer_to_iram();
   dma_transfer_to_wram();
@@ -21,51 +23,79 @@ void InitThread::init() {
 }
 
 void InitThread::launch() {
-  rank_->launch();
+  for (auto &rank : ranks()) {
+    rank->launch();
+  }
 
   std::cout << "launch completed..." << std::endl;
 }
 
+void InitThread::init(DPUID dpu_id) {
+  // the async host relaunches DPUs from several host threads, but only after
+  // init() has loaded the images
+  load_images();
+
+  dpu(dpu_id)->dma()->transfer_to_atomic(util::ConfigLoader::atomic_offset(),
+                                         atomic_byte_stream_);
+  dpu(dpu_id)->dma()->transfer_to_iram(util::ConfigLoader::iram_offset(),
+                                       iram_byte_stream_);
+  dpu(dpu_id)->dma()->transfer_to_wram(util::ConfigLoader::wram_offset(),
+                                       wram_byte_stream_);
+  dpu(dpu_id)->dma()->transfer_to_mram(util::ConfigLoader::mram_offset(),
+                                       mram_byte_stream_);
+}
+
+void InitThread::load_images() {
+  if (iram_byte_stream_ != nullptr) {
+    return;
+  }
+
+  atomic_byte_stream_ = load_byte_stream("atomic");
+  iram_byte_stream_ = load_byte_stream("iram");
+  wram_byte_stream_ = load_byte_stream("wram");
+  mram_byte_stream_ = load_byte_stream("mram");
+}
+
 void InitThread::dma_transfer_to_atomic() {
-  auto byte_stream = load_byte_stream("atomic");
-  for (auto &dpu : rank_->dpus()) {
-    dpu->dma()->transfer_to_atomic(util::ConfigLoader::atomic_offset(),
-                                   byte_stream);
+  for (auto &rank : ranks()) {
+    for (auto &dpu : rank->dpus()) {
+      dpu->dma()->transfer_to_atomic(util::ConfigLoader::atomic_offset(),
+                                     atomic_byte_stream_);
+    }
   }
-  delete byte_stream;
 
   std::cout << "DMA to atomic completed..." << std::endl;
 }
 
 void InitThread::dma_transfer_to_iram() {
-  auto byte_stream = load_byte_stream("iram");
-  for (auto &dpu : rank_->dpus()) {
-    dpu->dma()->transfer_to_iram(util::ConfigLoader::iram_offset(),
-                                 byte_stream);
+  for (auto &rank : ranks()) {
+    for (auto &dpu : rank->dpus()) {
+      dpu->dma()->transfer_to_iram(util::ConfigLoader::iram_offset(),
+                                   iram_byte_stream_);
+    }
   }
-  delete byte_stream;
 
   std::cout << "DMA to IRAM completed..." << std::endl;
 }
 
 void InitThread::dma_transfer_to_wram() {
-  auto byte_stream = load_byte_stream("wram");
-  for (auto &dpu : rank_->dpus()) {
-    dpu->dma()->transfer_to_wram(util::ConfigLoader::wram_offset(),
-                                 byte_stream);
+  for (auto &rank : ranks()) {
+    for (auto &dpu : rank->dpus()) {
+      dpu->dma()->transfer_to_wram(util::ConfigLoader::wram_offset(),
+                                   wram_byte_stream_);
+    }
   }
-  delete byte_stream;
 
   std::cout << "DMA to WRAM completed..." << std::endl;
 }
 
 void InitThread::dma_transfer_to_mram() {
-  auto byte_stream = load_byte_stream("mram");
-  for (auto &dpu : rank_->dpus()) {
-    dpu->dma()->transfer_to_mram(util::ConfigLoader::mram_offset(),
-                                 byte_stream);
+  for (auto &rank : ranks()) {
+    for (auto &dpu : rank->dpus()) {
+      dpu->dma()->transfer_to_mram(util::ConfigLoader::mram_offset(),
+                                   mram_byte_stream_);
+    }
   }
-  delete byte_stream;
 
   std::cout << "DMA to MRAM completed..." << std::endl;
 }
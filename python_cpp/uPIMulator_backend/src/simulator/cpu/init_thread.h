@@ -9,24 +9,36 @@ namespace upmem_sim::simulator::cpu {
 class InitThread : public Thread {
  public:
   explicit InitThread(util::ArgumentParser *argument_parser)
-      : Thread(argument_parser), rank_(nullptr) {}
-  ~InitThread() = default;
-
-  void connect_rank(rank::Rank *rank);
+      : Thread(argument_parser),
+        atomic_byte_stream_(nullptr),
+        iram_byte_stream_(nullptr),
+        wram_byte_stream_(nullptr),
+        mram_byte_stream_(nullptr) {}
+  ~InitThread();
 
   void init();
   void launch();
 
+  // reuses the images read by the first init, so that relaunches and script
+  // loads do not read them from disk per DPU
+  void init(DPUID dpu_id);
+  void launch(DPUID dpu_id) { rank(dpu_id)->launch(dpu_id); }
+
   void cycle() = delete;
 
  protected:
+  void load_images();
+
   void dma_transfer_to_atomic();
   void dma_transfer_to_iram();
   void dma_transfer_to_wram();
   void dma_transfer_to_mram();
 
  private:
-  rank::Rank *rank_;
+  encoder::ByteStream *atomic_byte_stream_;
+  encoder::ByteStream *iram_byte_stream_;
+  encoder::ByteStream *wram_byte_stream_;
+  encoder::ByteStream *mram_byte_stream_;
 };
 
 }  // namespace upmem_sim::simulator::cpu
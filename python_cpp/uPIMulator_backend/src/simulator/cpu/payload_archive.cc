@@ -0,0 +1,213 @@
+#include "simulator/cpu/payload_archive.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace upmem_sim::simulator::cpu {
+
+PayloadArchive::PayloadArchive(util::ArgumentParser *argument_parser)
+    : data_(nullptr),
+      size_(0),
+      num_dpus_(0),
+      num_executions_(0),
+      index_(nullptr),
+      decoding_execution_(-1),
+      stop_(false) {
+  std::string bin_filepath =
+      argument_parser->get_string_parameter("bindir") + "/" +
+      argument_parser->get_string_parameter("benchmark") + "." +
+      std::to_string(argument_parser->get_int_parameter("num_tasklets")) +
+      "/payloads.bin";
+
+  int fd = open(bin_filepath.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == -1 or st.st_size < 6 * sizeof(uint32_t)) {
+    close(fd);
+    throw std::invalid_argument("");
+  }
+
+  size_ = static_cast<size_t>(st.st_size);
+  void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::invalid_argument("");
+  }
+  data_ = static_cast<uint8_t *>(data);
+
+  uint32_t header[6];
+  std::memcpy(header, data_, sizeof(header));
+  if (std::memcmp(header, "UPMP", 4) != 0 or header[1] != 1 or
+      header[4] != NUM_KINDS) {
+    throw std::invalid_argument("");
+  }
+
+  num_dpus_ = static_cast<int>(header[2]);
+  num_executions_ = static_cast<int>(header[3]);
+  if (num_dpus_ != argument_parser->get_int_parameter("num_dpus") or
+      sizeof(header) + 2 * sizeof(uint64_t) * num_executions_ * num_dpus_ *
+                           NUM_KINDS >
+          size_) {
+    throw std::invalid_argument("");
+  }
+  index_ = reinterpret_cast<uint64_t *>(data_ + sizeof(header));
+
+  decoder_ = std::thread([this]() { run(); });
+}
+
+PayloadArchive::~PayloadArchive() {
+  if (decoder_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_variable_.notify_all();
+    decoder_.join();
+  }
+
+  for (auto &[key, byte_stream] : byte_streams_) {
+    delete byte_stream;
+  }
+
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+}
+
+std::string PayloadArchive::name(Kind kind) {
+  if (kind == INPUT_DPU_MRAM_HEAP_POINTER_NAME) {
+    return "input_dpu_mram_heap_pointer_name";
+  } else if (kind == OUTPUT_DPU_MRAM_HEAP_POINTER_NAME) {
+    return "output_dpu_mram_heap_pointer_name";
+  } else if (kind == DPU_INPUT_ARGUMENTS) {
+    return "dpu_input_arguments";
+  } else if (kind == DPU_RESULTS) {
+    return "dpu_results";
+  } else {
+    throw std::invalid_argument("");
+  }
+}
+
+PayloadArchive::Kind PayloadArchive::kind(std::string name) {
+  for (int kind = 0; kind < NUM_KINDS; kind++) {
+    if (PayloadArchive::name(static_cast<Kind>(kind)) == name) {
+      return static_cast<Kind>(kind);
+    }
+  }
+  throw std::invalid_argument("");
+}
+
+encoder::ByteStream *PayloadArchive::load(Kind kind, DPUID dpu_id,
+                                          int execution) {
+  assert(is_open());
+
+  encoder::ByteStream *byte_stream = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_variable_.wait(lock, [this, execution]() {
+      return decoding_execution_ != execution and
+             std::find(queued_executions_.begin(), queued_executions_.end(),
+                       execution) == queued_executions_.end();
+    });
+
+    auto it = byte_streams_.find({execution, dpu_id, kind});
+    if (it != byte_streams_.end()) {
+      byte_stream = it->second;
+      byte_streams_.erase(it);
+    }
+
+    // payloads of earlier executions that were never asked for; a late
+    // request for one decodes it again
+    auto end = byte_streams_.lower_bound({execution, 0, static_cast<Kind>(0)});
+    for (auto it = byte_streams_.begin(); it != end; it++) {
+      delete it->second;
+    }
+    byte_streams_.erase(byte_streams_.begin(), end);
+  }
+
+  if (byte_stream == nullptr) {
+    byte_stream = decode(kind, dpu_id, execution);
+  }
+
+  prefetch(execution + 1);
+
+  return byte_stream;
+}
+
+void PayloadArchive::prefetch(int execution) {
+  if (not is_open() or execution < 0 or execution >= num_executions_) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (not requested_executions_.insert(execution).second) {
+      return;
+    }
+    queued_executions_.push_back(execution);
+  }
+  condition_variable_.notify_all();
+}
+
+encoder::ByteStream *PayloadArchive::decode(Kind kind, DPUID dpu_id,
+                                            int execution) {
+  assert(0 <= dpu_id and dpu_id < num_dpus_);
+  assert(0 <= execution and execution < num_executions_);
+
+  uint64_t *entry =
+      index_ + 2 * ((execution * num_dpus_ + dpu_id) * NUM_KINDS + kind);
+  uint64_t offset = entry[0];
+  uint64_t length = entry[1];
+  if (offset == 0) {
+    return nullptr;
+  }
+  assert(offset + length <= size_);
+
+  return new encoder::ByteStream(
+      std::vector<int>(data_ + offset, data_ + offset + length));
+}
+
+void PayloadArchive::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_variable_.wait(
+        lock, [this]() { return stop_ or not queued_executions_.empty(); });
+    if (stop_) {
+      return;
+    }
+
+    int execution = queued_executions_.front();
+    queued_executions_.erase(queued_executions_.begin());
+    decoding_execution_ = execution;
+    lock.unlock();
+
+    std::vector<std::pair<Key, encoder::ByteStream *>> byte_streams;
+    for (DPUID dpu_id = 0; dpu_id < num_dpus_; dpu_id++) {
+      for (int kind = 0; kind < NUM_KINDS; kind++) {
+        auto byte_stream = decode(static_cast<Kind>(kind), dpu_id, execution);
+        if (byte_stream != nullptr) {
+          byte_streams.emplace_back(
+              Key{execution, dpu_id, static_cast<Kind>(kind)}, byte_stream);
+        }
+      }
+    }
+
+    lock.lock();
+    for (auto &[key, byte_stream] : byte_streams) {
+      byte_streams_[key] = byte_stream;
+    }
+    decoding_execution_ = -1;
+    condition_variable_.notify_all();
+  }
+}
+
+}  // namespace upmem_sim::simulator::cpu
@@ -0,0 +1,77 @@
+#ifndef UPMEM_SIM_SIMULATOR_CPU_PAYLOAD_ARCHIVE_H_
+#define UPMEM_SIM_SIMULATOR_CPU_PAYLOAD_ARCHIVE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "encoder/byte_stream.h"
+#include "main.h"
+#include "util/argument_parser.h"
+
+namespace upmem_sim::simulator::cpu {
+
+// Per-DPU, per-execution host payloads packed into payloads.bin:
+//   header: "UPMP", version, num_dpus, num_executions, num_kinds (uint32 each)
+//   index:  [execution][dpu][kind] -> (offset, length) (uint64 each)
+//   data:   one byte per payload byte
+// An offset of 0 marks a missing payload. The file is mapped once, and a
+// decoder thread turns the payloads of the next execution into byte streams
+// while the current one simulates. Prefetched payloads that were never
+// loaded are dropped once a later execution is loaded.
+class PayloadArchive {
+ public:
+  enum Kind {
+    INPUT_DPU_MRAM_HEAP_POINTER_NAME = 0,
+    OUTPUT_DPU_MRAM_HEAP_POINTER_NAME,
+    DPU_INPUT_ARGUMENTS,
+    DPU_RESULTS,
+    NUM_KINDS
+  };
+
+  explicit PayloadArchive(util::ArgumentParser *argument_parser);
+  ~PayloadArchive();
+
+  static std::string name(Kind kind);
+  static Kind kind(std::string name);
+
+  bool is_open() { return data_ != nullptr; }
+
+  // caller owns the returned byte stream; nullptr if there is no payload
+  encoder::ByteStream *load(Kind kind, DPUID dpu_id, int execution);
+  void prefetch(int execution);
+
+ protected:
+  encoder::ByteStream *decode(Kind kind, DPUID dpu_id, int execution);
+  void run();
+
+ private:
+  using Key = std::tuple<int, DPUID, Kind>;
+
+  uint8_t *data_;
+  size_t size_;
+
+  int num_dpus_;
+  int num_executions_;
+  uint64_t *index_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_variable_;
+  std::set<int> requested_executions_;
+  std::vector<int> queued_executions_;
+  int decoding_execution_;
+  std::map<Key, encoder::ByteStream *> byte_streams_;
+  bool stop_;
+
+  std::thread decoder_;
+};
+
+}  // namespace upmem_sim::simulator::cpu
+
+#endif
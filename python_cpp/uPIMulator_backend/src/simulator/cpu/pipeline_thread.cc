@@ -0,0 +1,110 @@
+#include "simulator/cpu/pipeline_thread.h"
+
+namespace upmem_sim::simulator::cpu {
+
+PipelineThread::PipelineThread(util::ArgumentParser *argument_parser)
+    : Thread(argument_parser), init_thread_(nullptr), sched_thread_(nullptr) {
+  phases_.resize(num_dpus(), DONE);
+  executions_.resize(num_dpus(), 0);
+  prefetched_executions_.resize(num_dpus(), 0);
+  prefetch_messages_.resize(num_dpus());
+  drain_messages_.resize(num_dpus());
+}
+
+void PipelineThread::connect_init_thread(InitThread *init_thread) {
+  assert(init_thread != nullptr);
+  assert(init_thread_ == nullptr);
+
+  init_thread_ = init_thread;
+}
+
+void PipelineThread::connect_sched_thread(SchedThread *sched_thread) {
+  assert(sched_thread != nullptr);
+  assert(sched_thread_ == nullptr);
+
+  sched_thread_ = sched_thread;
+}
+
+bool PipelineThread::is_finished() {
+  for (auto &rank : ranks()) {
+    if (not is_finished(rank)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PipelineThread::is_finished(rank::Rank *rank) {
+  for (auto &dpu : rank->dpus()) {
+    if (phases_[dpu->dpu_id()] != DONE) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void PipelineThread::launch() {
+  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
+    phases_[dpu_id] = RUN;
+    executions_[dpu_id] = 0;
+    prefetched_executions_[dpu_id] = 0;
+  }
+}
+
+void PipelineThread::cycle(rank::Rank *rank) {
+  for (auto &dpu : rank->dpus()) {
+    if (phases_[dpu->dpu_id()] == RUN) {
+      service_run(rank, dpu->dpu_id());
+    } else if (phases_[dpu->dpu_id()] == DRAIN) {
+      service_drain(rank, dpu->dpu_id());
+    }
+  }
+}
+
+void PipelineThread::service_run(rank::Rank *rank, DPUID dpu_id) {
+  int execution = executions_[dpu_id];
+
+  if (prefetched_executions_[dpu_id] == execution and
+      execution + 1 < num_executions()) {
+    prefetch_messages_[dpu_id] = sched_thread_->prefetch(execution + 1, dpu_id);
+    if (not prefetch_messages_[dpu_id].empty()) {
+      rank->push_xfer(prefetch_messages_[dpu_id]);
+    }
+    prefetched_executions_[dpu_id] = execution + 1;
+  }
+
+  if (rank->dpu(dpu_id)->is_zombie()) {
+    drain_messages_[dpu_id] = sched_thread_->check(execution, dpu_id);
+    if (not drain_messages_[dpu_id].empty()) {
+      rank->push_xfer(drain_messages_[dpu_id]);
+    }
+    phases_[dpu_id] = DRAIN;
+  }
+}
+
+void PipelineThread::service_drain(rank::Rank *rank, DPUID dpu_id) {
+  if (not retire(drain_messages_[dpu_id])) {
+    return;
+  }
+
+  if (executions_[dpu_id] + 1 == num_executions()) {
+    phases_[dpu_id] = DONE;
+    return;
+  }
+
+  if (not retire(prefetch_messages_[dpu_id])) {
+    return;
+  }
+
+  executions_[dpu_id] += 1;
+
+  if (benchmark() == "TRNS") {
+    init_thread_->init(dpu_id);
+  }
+  sched_thread_->sched(executions_[dpu_id], dpu_id);
+  init_thread_->launch(dpu_id);
+
+  phases_[dpu_id] = RUN;
+}
+
+}  // namespace upmem_sim::simulator::cpu
@@ -0,0 +1,50 @@
+#ifndef UPMEM_SIM_SIMULATOR_CPU_PIPELINE_THREAD_H_
+#define UPMEM_SIM_SIMULATOR_CPU_PIPELINE_THREAD_H_
+
+#include <vector>
+
+#include "simulator/cpu/init_thread.h"
+#include "simulator/cpu/sched_thread.h"
+#include "simulator/cpu/thread.h"
+#include "simulator/rank/rank.h"
+
+namespace upmem_sim::simulator::cpu {
+
+// Asynchronous host: while a DPU runs execution E, the inputs of execution E+1
+// are already pushed over the rank link. A DPU is relaunched as soon as its
+// own results of E are read back and its inputs of E+1 have arrived.
+class PipelineThread : public Thread {
+ public:
+  enum Phase { RUN = 0, DRAIN, DONE };
+
+  explicit PipelineThread(util::ArgumentParser *argument_parser);
+  ~PipelineThread() = default;
+
+  void connect_init_thread(InitThread *init_thread);
+  void connect_sched_thread(SchedThread *sched_thread);
+
+  bool is_finished();
+  bool is_finished(rank::Rank *rank);
+
+  void launch();
+  void cycle(rank::Rank *rank);
+
+ protected:
+  void service_run(rank::Rank *rank, DPUID dpu_id);
+  void service_drain(rank::Rank *rank, DPUID dpu_id);
+
+ private:
+  InitThread *init_thread_;
+  SchedThread *sched_thread_;
+
+  std::vector<Phase> phases_;
+  std::vector<int> executions_;
+  std::vector<int> prefetched_executions_;
+
+  std::vector<std::vector<rank::RankMessage *>> prefetch_messages_;
+  std::vector<std::vector<rank::RankMessage *>> drain_messages_;
+};
+
+}  // namespace upmem_sim::simulator::cpu
+
+#endif
@@ -1,179 +1,208 @@
 #include "simulator/cpu/sched_thread.h"
 
 #include <iostream>
-#include <sstream>
 
 #include "main.h"
 
 namespace upmem_sim::simulator::cpu {
 
-void SchedThread::connect_rank(rank::Rank *rank) {
-  assert(rank != nullptr);
-  assert(rank_ == nullptr);
-
-  rank_ = rank;
-}
-
 void SchedThread::sched(int execution) {
-  dma_transfer_input_dpu_mram_heap_pointer_name(execution);
-  dma_transfer_dpu_input_arguments(execution);
+  std::vector<rank::RankMessage *> rank_messages;
+  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
+    rank::RankMessage *rank_message =
+        dma_transfer_input_dpu_mram_heap_pointer_name(execution, dpu_id, true);
+    if (rank_message != nullptr) {
+      rank_messages.push_back(rank_message);
+    }
+  }
+  push_xfer(rank_messages);
+  wait(rank_messages);
+
+  rank_messages.clear();
+  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
+    rank::RankMessage *rank_message =
+        dma_transfer_dpu_input_arguments(execution, dpu_id, true);
+    if (rank_message != nullptr) {
+      rank_messages.push_back(rank_message);
+    }
+  }
+  push_xfer(rank_messages);
+  wait(rank_messages);
 
   std::cout << "sched " << execution << " completed..." << std::endl;
 }
 
 void SchedThread::check(int execution) {
-  dma_transfer_output_dpu_mram_heap_pointer_name(execution);
-  dma_transfer_dpu_results(execution);
-
-  std::cout << "check " << execution << " completed..." << std::endl;
-}
-
-void SchedThread::dma_transfer_input_dpu_mram_heap_pointer_name(int execution) {
-  std::set<rank::RankMessage*> rank_messages;
+  std::vector<rank::RankMessage *> rank_messages;
   for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
-    std::stringstream ss;
-    ss << "input_dpu_mram_heap_pointer_name.dpu_id" << dpu_id << "."
-       << execution;
+    rank::RankMessage *rank_message =
+        dma_transfer_output_dpu_mram_heap_pointer_name(execution, dpu_id);
+    if (rank_message != nullptr) {
+      rank_messages.push_back(rank_message);
+    }
+  }
+  push_xfer(rank_messages);
+  wait(rank_messages);
 
-    std::string bin_filename;
-    ss >> bin_filename;
+  rank_messages.clear();
+  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
+    rank::RankMessage *rank_message =
+        dma_transfer_dpu_results(execution, dpu_id);
+    if (rank_message != nullptr) {
+      rank_messages.push_back(rank_message);
+    }
+  }
+  push_xfer(rank_messages);
+  wait(rank_messages);
 
-    auto byte_stream = load_byte_stream(bin_filename);
+  std::cout << "check " << execution << " completed..." << std::endl;
+}
 
-    if (byte_stream != nullptr) {
-      auto rank_message = new rank::RankMessage(
-          rank::RankMessage::WRITE, dpu_id, sys_used_mram_end_pointer(),
-          byte_stream->size(), byte_stream);
-      rank_->write(rank_message);
-      rank_messages.insert(rank_message);
+std::vector<rank::RankMessage *> SchedThread::prefetch(int execution,
+                                                       DPUID dpu_id) {
+  std::vector<rank::RankMessage *> rank_messages;
+  for (auto &rank_message :
+       {dma_transfer_input_dpu_mram_heap_pointer_name(execution, dpu_id, false),
+        dma_transfer_dpu_input_arguments(execution, dpu_id, false)}) {
+    if (rank_message != nullptr) {
+      rank_messages.push_back(rank_message);
+    }
+  }
+  return rank_messages;
+}
 
-      rank_->dpus()[dpu_id]->dma()->transfer_to_mram(
-          sys_used_mram_end_pointer(), byte_stream);
+void SchedThread::sched(int execution, DPUID dpu_id) {
+  delete dma_transfer_input_dpu_mram_heap_pointer_name(execution, dpu_id, true);
+  delete dma_transfer_dpu_input_arguments(execution, dpu_id, true);
+}
 
-      delete byte_stream;
+std::vector<rank::RankMessage *> SchedThread::check(int execution,
+                                                    DPUID dpu_id) {
+  std::vector<rank::RankMessage *> rank_messages;
+  for (auto &rank_message :
+       {dma_transfer_output_dpu_mram_heap_pointer_name(execution, dpu_id),
+        dma_transfer_dpu_results(execution, dpu_id)}) {
+    if (rank_message != nullptr) {
+      rank_messages.push_back(rank_message);
     }
   }
+  return rank_messages;
+}
 
-  for (auto & rank_message : rank_messages) {
-    while (not rank_message->ack()) {
-      rank_->cycle();
-    }
+rank::RankMessage *SchedThread::dma_transfer_input_dpu_mram_heap_pointer_name(
+    int execution, DPUID dpu_id, bool functional) {
+  auto byte_stream = load_payload(
+      PayloadArchive::INPUT_DPU_MRAM_HEAP_POINTER_NAME, dpu_id, execution);
 
-    delete rank_message;
+  if (byte_stream == nullptr) {
+    return nullptr;
   }
-}
 
-void SchedThread::dma_transfer_dpu_input_arguments(int execution) {
-  std::set<rank::RankMessage*> rank_messages;
-  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
-    std::stringstream ss;
-    ss << "dpu_input_arguments.dpu_id" << dpu_id << "." << execution;
+  auto rank_message = new rank::RankMessage(
+      rank::RankMessage::WRITE, dpu_id, sys_used_mram_end_pointer(),
+      byte_stream->size(), byte_stream);
 
-    std::string bin_filename;
-    ss >> bin_filename;
+  if (functional) {
+    dpu(dpu_id)->dma()->transfer_to_mram(sys_used_mram_end_pointer(),
+                                         byte_stream);
+  }
 
-    auto byte_stream = load_byte_stream(bin_filename);
+  delete byte_stream;
 
-    if (byte_stream != nullptr) {
-      auto rank_message = new rank::RankMessage(
-          rank::RankMessage::WRITE, dpu_id, dpu_input_arguments_pointer(),
-          byte_stream->size(), byte_stream);
-      rank_->write(rank_message);
-      rank_messages.insert(rank_message);
+  return rank_message;
+}
 
-      rank_->dpus()[dpu_id]->dma()->transfer_to_wram(
-          dpu_input_arguments_pointer(), byte_stream);
+rank::RankMessage *SchedThread::dma_transfer_dpu_input_arguments(
+    int execution, DPUID dpu_id, bool functional) {
+  auto byte_stream =
+      load_payload(PayloadArchive::DPU_INPUT_ARGUMENTS, dpu_id, execution);
 
-      delete byte_stream;
-    }
+  if (byte_stream == nullptr) {
+    return nullptr;
   }
 
-  for (auto & rank_message : rank_messages) {
-    while (not rank_message->ack()) {
-      rank_->cycle();
-    }
-    delete rank_message;
+  auto rank_message = new rank::RankMessage(
+      rank::RankMessage::WRITE, dpu_id, dpu_input_arguments_pointer(),
+      byte_stream->size(), byte_stream);
+
+  if (functional) {
+    dpu(dpu_id)->dma()->transfer_to_wram(dpu_input_arguments_pointer(),
+                                         byte_stream);
   }
-}
 
-void SchedThread::dma_transfer_output_dpu_mram_heap_pointer_name(
-    int execution) {
-  std::set<rank::RankMessage*> rank_messages;
-  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
-    std::stringstream ss;
-    ss << "output_dpu_mram_heap_pointer_name.dpu_id" << dpu_id << "."
-       << execution;
+  delete byte_stream;
 
-    std::string bin_filename;
-    ss >> bin_filename;
+  return rank_message;
+}
 
-    auto byte_stream = load_byte_stream(bin_filename);
+rank::RankMessage *SchedThread::dma_transfer_output_dpu_mram_heap_pointer_name(
+    int execution, DPUID dpu_id) {
+  auto byte_stream = load_payload(
+      PayloadArchive::OUTPUT_DPU_MRAM_HEAP_POINTER_NAME, dpu_id, execution);
 
-    if (byte_stream != nullptr) {
-      auto rank_message = new rank::RankMessage(rank::RankMessage::READ, dpu_id,
-                                                sys_used_mram_end_pointer(),
-                                                byte_stream->size());
-      rank_->read(rank_message);
-      rank_messages.insert(rank_message);
+  if (byte_stream == nullptr) {
+    return nullptr;
+  }
 
-      encoder::ByteStream *mram_byte_stream =
-          rank_->dpus()[dpu_id]->dma()->transfer_from_mram(
-              sys_used_mram_end_pointer(), byte_stream->size());
+  auto rank_message =
+      new rank::RankMessage(rank::RankMessage::READ, dpu_id,
+                            sys_used_mram_end_pointer(), byte_stream->size());
 
-      assert(byte_stream->size() == mram_byte_stream->size());
-      for (int i = 0; i < byte_stream->size(); i++) {
-        assert(byte_stream->byte(i) == mram_byte_stream->byte(i));
-      }
+  encoder::ByteStream *mram_byte_stream =
+      dpu(dpu_id)->dma()->transfer_from_mram(sys_used_mram_end_pointer(),
+                                             byte_stream->size());
 
-      delete byte_stream;
-      delete mram_byte_stream;
-    }
+  assert(byte_stream->size() == mram_byte_stream->size());
+  for (int i = 0; i < byte_stream->size(); i++) {
+    assert(byte_stream->byte(i) == mram_byte_stream->byte(i));
   }
 
-  for (auto & rank_message : rank_messages) {
-    while (not rank_message->ack()) {
-      rank_->cycle();
-    }
-    delete rank_message;
-  }
+  delete byte_stream;
+  delete mram_byte_stream;
+
+  return rank_message;
 }
 
-void SchedThread::dma_transfer_dpu_results(int execution) {
-  std::set<rank::RankMessage*> rank_messages;
-  for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
-    std::stringstream ss;
-    ss << "dpu_results.dpu_id" << dpu_id << "." << execution;
+rank::RankMessage *SchedThread::dma_transfer_dpu_results(int execution,
+                                                         DPUID dpu_id) {
+  auto byte_stream =
+      load_payload(PayloadArchive::DPU_RESULTS, dpu_id, execution);
 
-    std::string bin_filename;
-    ss >> bin_filename;
+  if (byte_stream == nullptr) {
+    return nullptr;
+  }
 
-    auto byte_stream = load_byte_stream(bin_filename);
+  auto rank_message =
+      new rank::RankMessage(rank::RankMessage::READ, dpu_id,
+                            dpu_results_pointer(), byte_stream->size());
 
-    if (byte_stream != nullptr) {
-      auto rank_message =
-          new rank::RankMessage(rank::RankMessage::READ, dpu_id,
-                                dpu_results_pointer(), byte_stream->size());
-      rank_->read(rank_message);
-      rank_messages.insert(rank_message);
+  encoder::ByteStream *wram_byte_stream =
+      dpu(dpu_id)->dma()->transfer_from_wram(dpu_results_pointer(),
+                                             byte_stream->size());
 
-      encoder::ByteStream *wram_byte_stream =
-          rank_->dpus()[dpu_id]->dma()->transfer_from_wram(
-              dpu_results_pointer(), byte_stream->size());
+  assert(byte_stream->size() == wram_byte_stream->size());
+  for (int i = 0; i < byte_stream->size(); i++) {
+    assert(byte_stream->byte(i) == wram_byte_stream->byte(i));
+  }
 
-      assert(byte_stream->size() == wram_byte_stream->size());
-      for (int i = 0; i < byte_stream->size(); i++) {
-        assert(byte_stream->byte(i) == wram_byte_stream->byte(i));
-      }
+  delete byte_stream;
+  delete wram_byte_stream;
+
+  return rank_message;
+}
 
-      delete byte_stream;
-      delete wram_byte_stream;
+void SchedThread::wait(std::vector<rank::RankMessage *> rank_messages) {
+  for (auto &rank : ranks()) {
+    for (auto &rank_message : rank_messages) {
+      if (rank->has_dpu(rank_message->dpu_id())) {
+        while (not rank_message->ack()) {
+          rank->cycle();
+        }
+      }
     }
   }
 
-  for (auto & rank_message : rank_messages) {
-    while (not rank_message->ack()) {
-      rank_->cycle();
-    }
+  for (auto &rank_message : rank_messages) {
     delete rank_message;
   }
 }
@@ -1,6 +1,8 @@
 #ifndef UPMEM_SIM_SIMULATOR_CPU_SCHED_THREAD_H_
 #define UPMEM_SIM_SIMULATOR_CPU_SCHED_THREAD_H_
 
+#include <vector>
+
 #include "simulator/cpu/thread.h"
 #include "simulator/rank/rank.h"
 
@@ -9,25 +11,30 @@ namespace upmem_sim::simulator::cpu {
 class SchedThread : public Thread {
  public:
   explicit SchedThread(util::ArgumentParser *argument_parser)
-      : Thread(argument_parser), rank_(nullptr) {}
+      : Thread(argument_parser) {}
   ~SchedThread() = default;
 
-  void connect_rank(rank::Rank *rank);
-
   void sched(int execution);
   void check(int execution);
 
+  std::vector<rank::RankMessage *> prefetch(int execution, DPUID dpu_id);
+  void sched(int execution, DPUID dpu_id);
+  std::vector<rank::RankMessage *> check(int execution, DPUID dpu_id);
+
   void cycle() = delete;
 
  protected:
-  void dma_transfer_input_dpu_mram_heap_pointer_name(int execution);
-  void dma_transfer_dpu_input_arguments(int execution);
+  rank::RankMessage *dma_transfer_input_dpu_mram_heap_pointer_name(
+      int execution, DPUID dpu_id, bool functional);
+  rank::RankMessage *dma_transfer_dpu_input_arguments(int execution,
+                                                      DPUID dpu_id,
+                                                      bool functional);
 
-  void dma_transfer_output_dpu_mram_heap_pointer_name(int execution);
-  void dma_transfer_dpu_results(int execution);
+  rank::RankMessage *dma_transfer_output_dpu_mram_heap_pointer_name(
+      int execution, DPUID dpu_id);
+  rank::RankMessage *dma_transfer_dpu_results(int execution, DPUID dpu_id);
 
- private:
-  rank::Rank *rank_;
+  void wait(std::vector<rank::RankMessage *> rank_messages);
 };
 
 }  // namespace upmem_sim::simulator::cpu
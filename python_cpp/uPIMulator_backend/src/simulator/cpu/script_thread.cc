@@ -0,0 +1,438 @@
+#include "simulator/cpu/script_thread.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace upmem_sim::simulator::cpu {
+
+ScriptThread::ScriptThread(util::ArgumentParser *argument_parser)
+    : Thread(argument_parser), init_thread_(nullptr), pc_(0) {
+  if (argument_parser->get_string_parameter("host_model") == "script") {
+    init_host_commands(argument_parser->get_string_parameter("host_script"));
+  }
+}
+
+ScriptThread::~ScriptThread() {
+  for (auto &host_command : host_commands_) {
+    delete host_command;
+  }
+
+  for (auto &rank_message : pending_messages_) {
+    delete rank_message;
+  }
+  for (auto &rank_message : outstanding_messages_) {
+    delete rank_message;
+  }
+}
+
+void ScriptThread::connect_init_thread(InitThread *init_thread) {
+  assert(init_thread != nullptr);
+  assert(init_thread_ == nullptr);
+
+  init_thread_ = init_thread;
+}
+
+bool ScriptThread::is_finished() {
+  if (pc_ < host_commands_.size() or not pending_messages_.empty()) {
+    return false;
+  }
+
+  retire_outstanding();
+  if (not outstanding_messages_.empty()) {
+    return false;
+  }
+
+  for (auto &rank : ranks()) {
+    if (not rank->is_idle()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ScriptThread::cycle() {
+  retire_outstanding();
+
+  while (pc_ < host_commands_.size() and execute(host_commands_[pc_])) {
+  }
+}
+
+void ScriptThread::init_host_commands(std::string filename) {
+  std::ifstream ifs(bindir() + "/" + benchmark() + "." +
+                    std::to_string(num_tasklets()) + "/" + filename + ".bin");
+  if (not ifs.is_open()) {
+    throw std::invalid_argument("");
+  }
+
+  std::vector<int> loop_pcs;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::stringstream ss(line);
+
+    std::string opcode;
+    ss >> opcode;
+    if (opcode.empty() or opcode[0] == '#') {
+      continue;
+    }
+
+    std::vector<std::string> operands;
+    std::string operand;
+    while (ss >> operand) {
+      operands.push_back(operand);
+    }
+
+    HostCommand::Kind kind;
+    int min_num_operands;
+    int max_num_operands;
+    if (opcode == "load") {
+      kind = HostCommand::LOAD;
+      min_num_operands = max_num_operands = 1;
+    } else if (opcode == "xfer_to") {
+      kind = HostCommand::XFER_TO;
+      min_num_operands = 4;
+      max_num_operands = 5;
+    } else if (opcode == "xfer_from") {
+      kind = HostCommand::XFER_FROM;
+      min_num_operands = 4;
+      max_num_operands = 5;
+    } else if (opcode == "compare") {
+      kind = HostCommand::COMPARE;
+      min_num_operands = max_num_operands = 4;
+    } else if (opcode == "launch") {
+      kind = HostCommand::LAUNCH;
+      min_num_operands = max_num_operands = 1;
+    } else if (opcode == "wait") {
+      kind = HostCommand::WAIT;
+      min_num_operands = max_num_operands = 1;
+    } else if (opcode == "loop") {
+      kind = HostCommand::LOOP;
+      min_num_operands = max_num_operands = 2;
+    } else if (opcode == "end") {
+      kind = HostCommand::END;
+      min_num_operands = max_num_operands = 0;
+    } else {
+      throw std::invalid_argument("");
+    }
+
+    if (operands.size() < min_num_operands or
+        operands.size() > max_num_operands) {
+      throw std::invalid_argument("");
+    }
+    if (operands.size() == 5 and operands[4] != "async") {
+      throw std::invalid_argument("");
+    }
+
+    auto host_command = new HostCommand(kind, operands);
+    if (kind == HostCommand::LOOP) {
+      if (operands[0] == "d") {
+        throw std::invalid_argument("");
+      }
+      loop_pcs.push_back(static_cast<int>(host_commands_.size()));
+    } else if (kind == HostCommand::END) {
+      if (loop_pcs.empty()) {
+        throw std::invalid_argument("");
+      }
+      host_command->set_jump(loop_pcs.back());
+      host_commands_[loop_pcs.back()]->set_jump(
+          static_cast<int>(host_commands_.size()));
+      loop_pcs.pop_back();
+    }
+    host_commands_.push_back(host_command);
+  }
+
+  if (not loop_pcs.empty()) {
+    throw std::invalid_argument("");
+  }
+}
+
+bool ScriptThread::execute(HostCommand *host_command) {
+  if (not pending_messages_.empty()) {
+    if (not retire(pending_messages_)) {
+      return false;
+    }
+    pc_ += 1;
+    return true;
+  }
+
+  if (host_command->kind() == HostCommand::LOOP) {
+    if (std::stoi(host_command->operand(1)) > 0) {
+      variables_[host_command->operand(0)] = 0;
+      pc_ += 1;
+    } else {
+      pc_ = host_command->jump() + 1;
+    }
+    return true;
+  } else if (host_command->kind() == HostCommand::END) {
+    HostCommand *loop_command = host_commands_[host_command->jump()];
+    int &iteration = variables_[loop_command->operand(0)];
+
+    iteration += 1;
+    if (iteration < std::stoi(loop_command->operand(1))) {
+      pc_ = host_command->jump() + 1;
+    } else {
+      variables_.erase(loop_command->operand(0));
+      pc_ += 1;
+    }
+    return true;
+  }
+
+  int dpus_index = host_command->kind() == HostCommand::XFER_TO or
+                           host_command->kind() == HostCommand::XFER_FROM or
+                           host_command->kind() == HostCommand::COMPARE
+                       ? 1
+                       : 0;
+  std::vector<DPUID> dpu_ids =
+      parse_dpu_ids(host_command->operand(dpus_index));
+
+  if (not is_idle(dpu_ids)) {
+    return false;
+  }
+
+  if (host_command->kind() == HostCommand::LOAD) {
+    for (auto &dpu_id : dpu_ids) {
+      init_thread_->init(dpu_id);
+    }
+  } else if (host_command->kind() == HostCommand::XFER_TO or
+             host_command->kind() == HostCommand::XFER_FROM) {
+    std::vector<rank::RankMessage *> rank_messages = transfer(host_command);
+    if (host_command->num_operands() == 5) {
+      outstanding_messages_.insert(outstanding_messages_.end(),
+                                   rank_messages.begin(), rank_messages.end());
+    } else if (not rank_messages.empty()) {
+      pending_messages_ = std::move(rank_messages);
+      return false;
+    }
+  } else if (host_command->kind() == HostCommand::COMPARE) {
+    compare(host_command);
+  } else if (host_command->kind() == HostCommand::LAUNCH) {
+    if (has_outstanding(dpu_ids)) {
+      return false;
+    }
+    for (auto &dpu_id : dpu_ids) {
+      init_thread_->launch(dpu_id);
+    }
+  } else if (host_command->kind() == HostCommand::WAIT) {
+    if (has_outstanding(dpu_ids)) {
+      return false;
+    }
+  } else {
+    throw std::invalid_argument("");
+  }
+
+  pc_ += 1;
+  return true;
+}
+
+std::vector<rank::RankMessage *> ScriptThread::transfer(
+    HostCommand *host_command) {
+  std::string region = host_command->operand(0);
+  std::vector<DPUID> dpu_ids = parse_dpu_ids(host_command->operand(1));
+  Address address = parse_address(host_command->operand(2));
+  bool is_broadcast =
+      host_command->kind() == HostCommand::XFER_TO and
+      host_command->operand(3).find("$d") == std::string::npos and
+      host_command->operand(3).rfind("payload:", 0) == std::string::npos;
+
+  // a broadcast reads its file once for every DPU
+  encoder::ByteStream *broadcast_byte_stream = nullptr;
+  if (is_broadcast and not dpu_ids.empty()) {
+    broadcast_byte_stream = load(
+        substitute(host_command->operand(3), dpu_ids[0]), dpu_ids[0]);
+  }
+
+  std::vector<rank::RankMessage *> rank_messages;
+  for (auto &dpu_id : dpu_ids) {
+    auto byte_stream =
+        is_broadcast
+            ? broadcast_byte_stream
+            : load(substitute(host_command->operand(3), dpu_id), dpu_id);
+    if (byte_stream == nullptr) {
+      continue;
+    }
+
+    if (host_command->kind() == HostCommand::XFER_TO) {
+      if (region == "atomic") {
+        dpu(dpu_id)->dma()->transfer_to_atomic(address, byte_stream);
+      } else if (region == "iram") {
+        dpu(dpu_id)->dma()->transfer_to_iram(address, byte_stream);
+      } else if (region == "wram") {
+        dpu(dpu_id)->dma()->transfer_to_wram(address, byte_stream);
+      } else if (region == "mram") {
+        dpu(dpu_id)->dma()->transfer_to_mram(address, byte_stream);
+      } else {
+        throw std::invalid_argument("");
+      }
+
+      rank_messages.push_back(
+          new rank::RankMessage(rank::RankMessage::WRITE, dpu_id, address,
+                                byte_stream->size(), byte_stream));
+    } else {
+      if (region != "wram" and region != "mram") {
+        throw std::invalid_argument("");
+      }
+
+      rank_messages.push_back(new rank::RankMessage(
+          rank::RankMessage::READ, dpu_id, address, byte_stream->size()));
+    }
+
+    if (not is_broadcast) {
+      delete byte_stream;
+    }
+  }
+  delete broadcast_byte_stream;
+
+  if (is_broadcast and rank_messages.size() > 1) {
+    broadcast(rank_messages);
+  } else if (not rank_messages.empty()) {
+    push_xfer(rank_messages);
+  }
+
+  return rank_messages;
+}
+
+void ScriptThread::compare(HostCommand *host_command) {
+  std::string region = host_command->operand(0);
+  Address address = parse_address(host_command->operand(2));
+
+  for (auto &dpu_id : parse_dpu_ids(host_command->operand(1))) {
+    auto byte_stream =
+        load(substitute(host_command->operand(3), dpu_id), dpu_id);
+    if (byte_stream == nullptr) {
+      continue;
+    }
+
+    encoder::ByteStream *dpu_byte_stream;
+    if (region == "wram") {
+      dpu_byte_stream =
+          dpu(dpu_id)->dma()->transfer_from_wram(address, byte_stream->size());
+    } else if (region == "mram") {
+      dpu_byte_stream =
+          dpu(dpu_id)->dma()->transfer_from_mram(address, byte_stream->size());
+    } else {
+      throw std::invalid_argument("");
+    }
+
+    assert(byte_stream->size() == dpu_byte_stream->size());
+    for (int i = 0; i < byte_stream->size(); i++) {
+      assert(byte_stream->byte(i) == dpu_byte_stream->byte(i));
+    }
+
+    delete byte_stream;
+    delete dpu_byte_stream;
+  }
+}
+
+encoder::ByteStream *ScriptThread::load(std::string token, DPUID dpu_id) {
+  if (token.rfind("payload:", 0) == 0) {
+    size_t colon = token.rfind(':');
+    return load_payload(PayloadArchive::kind(token.substr(8, colon - 8)),
+                        dpu_id, std::stoi(token.substr(colon + 1)));
+  } else {
+    return load_byte_stream(token);
+  }
+}
+
+bool ScriptThread::is_idle(std::vector<DPUID> &dpu_ids) {
+  for (auto &dpu_id : dpu_ids) {
+    if (not dpu(dpu_id)->is_idle()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ScriptThread::has_outstanding(std::vector<DPUID> &dpu_ids) {
+  for (auto &rank_message : outstanding_messages_) {
+    if (std::find(dpu_ids.begin(), dpu_ids.end(), rank_message->dpu_id()) !=
+        dpu_ids.end()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ScriptThread::retire_outstanding() {
+  std::vector<rank::RankMessage *> rank_messages;
+  for (auto &rank_message : outstanding_messages_) {
+    if (rank_message->ack()) {
+      delete rank_message;
+    } else {
+      rank_messages.push_back(rank_message);
+    }
+  }
+  outstanding_messages_ = std::move(rank_messages);
+}
+
+std::vector<DPUID> ScriptThread::parse_dpu_ids(std::string token) {
+  std::vector<DPUID> dpu_ids;
+  if (token == "*") {
+    for (DPUID dpu_id = 0; dpu_id < num_dpus(); dpu_id++) {
+      dpu_ids.push_back(dpu_id);
+    }
+    return dpu_ids;
+  }
+
+  std::stringstream ss(token);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    size_t dash = range.find('-');
+    DPUID begin = std::stoi(range.substr(0, dash));
+    DPUID end =
+        dash == std::string::npos ? begin : std::stoi(range.substr(dash + 1));
+    if (begin > end or end >= num_dpus()) {
+      throw std::invalid_argument("");
+    }
+
+    for (DPUID dpu_id = begin; dpu_id <= end; dpu_id++) {
+      dpu_ids.push_back(dpu_id);
+    }
+  }
+  return dpu_ids;
+}
+
+Address ScriptThread::parse_address(std::string token) {
+  if (token == "@atomic") {
+    return util::ConfigLoader::atomic_offset();
+  } else if (token == "@iram") {
+    return util::ConfigLoader::iram_offset();
+  } else if (token == "@wram") {
+    return util::ConfigLoader::wram_offset();
+  } else if (token == "@mram") {
+    return util::ConfigLoader::mram_offset();
+  } else if (token == "@sys_used_mram_end") {
+    return sys_used_mram_end_pointer();
+  } else if (token == "@dpu_input_arguments") {
+    return dpu_input_arguments_pointer();
+  } else if (token == "@dpu_results") {
+    return dpu_results_pointer();
+  } else {
+    return std::stoll(token, nullptr, 0);
+  }
+}
+
+std::string ScriptThread::substitute(std::string token, DPUID dpu_id) {
+  std::vector<std::pair<std::string, std::string>> substitutions;
+  substitutions.emplace_back("$d", std::to_string(dpu_id));
+  for (auto &[name, iteration] : variables_) {
+    substitutions.emplace_back("$" + name, std::to_string(iteration));
+  }
+
+  // longer names first so that $e does not clobber $ex
+  std::sort(substitutions.begin(), substitutions.end(),
+            [](auto &lhs, auto &rhs) {
+              return lhs.first.size() > rhs.first.size();
+            });
+
+  for (auto &[pattern, value] : substitutions) {
+    size_t pos;
+    while ((pos = token.find(pattern)) != std::string::npos) {
+      token.replace(pos, pattern.size(), value);
+    }
+  }
+  return token;
+}
+
+}  // namespace upmem_sim::simulator::cpu
@@ -0,0 +1,71 @@
+#ifndef UPMEM_SIM_SIMULATOR_CPU_SCRIPT_THREAD_H_
+#define UPMEM_SIM_SIMULATOR_CPU_SCRIPT_THREAD_H_
+
+#include <map>
+#include <vector>
+
+#include "simulator/cpu/host_command.h"
+#include "simulator/cpu/init_thread.h"
+#include "simulator/cpu/thread.h"
+#include "simulator/rank/rank.h"
+
+namespace upmem_sim::simulator::cpu {
+
+// Host program read from <host_script>.bin in the benchmark directory, one
+// command per line:
+//   load <dpus>
+//   xfer_to <atomic|iram|wram|mram> <dpus> <address> <file> [async]
+//   xfer_from <wram|mram> <dpus> <address> <file> [async]
+//   compare <wram|mram> <dpus> <address> <file>
+//   launch <dpus>
+//   wait <dpus>
+//   loop <var> <count> ... end
+// <dpus> is '*' or a list such as 0-3,7. <address> is an integer or one of
+// @atomic, @iram, @wram, @mram, @sys_used_mram_end, @dpu_input_arguments and
+// @dpu_results. In <file>, $d expands to the DPU ID and $<var> to the
+// iteration of the enclosing loop, and payload:<kind>:<execution> reads the
+// DPU's payload from the payload archive. An xfer_to whose file is neither
+// per-DPU nor a payload is broadcast. Commands touching DPU memory stall
+// until their DPUs are idle, and launch and wait also stall until their DPUs'
+// transfers are acked.
+class ScriptThread : public Thread {
+ public:
+  explicit ScriptThread(util::ArgumentParser *argument_parser);
+  ~ScriptThread();
+
+  void connect_init_thread(InitThread *init_thread);
+
+  bool is_finished();
+
+  void cycle();
+
+ protected:
+  void init_host_commands(std::string filename);
+
+  bool execute(HostCommand *host_command);
+  std::vector<rank::RankMessage *> transfer(HostCommand *host_command);
+  void compare(HostCommand *host_command);
+  encoder::ByteStream *load(std::string token, DPUID dpu_id);
+
+  bool is_idle(std::vector<DPUID> &dpu_ids);
+  bool has_outstanding(std::vector<DPUID> &dpu_ids);
+  void retire_outstanding();
+
+  std::vector<DPUID> parse_dpu_ids(std::string token);
+  Address parse_address(std::string token);
+  std::string substitute(std::string token, DPUID dpu_id);
+
+ private:
+  InitThread *init_thread_;
+
+  std::vector<HostCommand *> host_commands_;
+  int pc_;
+  std::map<std::string, int> variables_;
+
+  std::vector<rank::RankMessage *> pending_messages_;
+  std::vector<rank::RankMessage *> outstanding_messages_;
+};
+
+}  // namespace upmem_sim::simulator::cpu
+
+#endif
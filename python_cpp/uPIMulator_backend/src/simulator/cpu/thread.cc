@@ -12,7 +12,9 @@ Thread::Thread(util::ArgumentParser *argument_parser)
       num_dpus_(
           static_cast<int>(argument_parser->get_int_parameter("num_dpus"))),
       num_tasklets_(static_cast<int>(
-          argument_parser->get_int_parameter("num_tasklets"))) {
+          argument_parser->get_int_parameter("num_tasklets"))),
+      topology_(nullptr),
+      payload_archive_(nullptr) {
   assert(0 < num_dpus_);
   assert(0 < num_tasklets_ and
          num_tasklets_ <= util::ConfigLoader::max_num_tasklets());
@@ -21,6 +23,34 @@ Thread::Thread(util::ArgumentParser *argument_parser)
   init_num_executions();
 }
 
+void Thread::connect_topology(rank::Topology *topology) {
+  assert(topology != nullptr);
+  assert(topology_ == nullptr);
+
+  topology_ = topology;
+}
+
+void Thread::connect_rank(rank::Rank *rank) {
+  assert(rank != nullptr);
+  assert(rank->rank_id() == ranks_.size());
+
+  ranks_.push_back(rank);
+}
+
+void Thread::connect_payload_archive(PayloadArchive *payload_archive) {
+  assert(payload_archive != nullptr);
+  assert(payload_archive_ == nullptr);
+
+  payload_archive_ = payload_archive;
+}
+
+rank::Rank *Thread::rank(DPUID dpu_id) {
+  int rank_id = topology_->rank_id(dpu_id);
+  assert(rank_id < ranks_.size());
+
+  return ranks_[rank_id];
+}
+
 encoder::ByteStream *Thread::load_byte_stream(std::string filename) {
   std::string bin_filepath = bindir_ + "/" + benchmark_ + "." +
                              std::to_string(num_tasklets_) + "/" + filename +
@@ -33,6 +63,60 @@ encoder::ByteStream *Thread::load_byte_stream(std::string filename) {
   }
 }
 
+encoder::ByteStream *Thread::load_payload(PayloadArchive::Kind kind,
+                                          DPUID dpu_id, int execution) {
+  if (payload_archive_ != nullptr and payload_archive_->is_open()) {
+    return payload_archive_->load(kind, dpu_id, execution);
+  } else {
+    return load_byte_stream(PayloadArchive::name(kind) + ".dpu_id" +
+                            std::to_string(dpu_id) + "." +
+                            std::to_string(execution));
+  }
+}
+
+void Thread::push_xfer(std::vector<rank::RankMessage *> rank_messages) {
+  std::vector<std::vector<rank::RankMessage *>> rank_xfers(ranks_.size());
+  for (auto &rank_message : rank_messages) {
+    rank_xfers[topology_->rank_id(rank_message->dpu_id())].push_back(
+        rank_message);
+  }
+
+  for (auto &rank : ranks_) {
+    if (not rank_xfers[rank->rank_id()].empty()) {
+      rank->push_xfer(rank_xfers[rank->rank_id()]);
+    }
+  }
+}
+
+void Thread::broadcast(std::vector<rank::RankMessage *> rank_messages) {
+  std::vector<std::vector<rank::RankMessage *>> rank_xfers(ranks_.size());
+  for (auto &rank_message : rank_messages) {
+    rank_xfers[topology_->rank_id(rank_message->dpu_id())].push_back(
+        rank_message);
+  }
+
+  for (auto &rank : ranks_) {
+    if (not rank_xfers[rank->rank_id()].empty()) {
+      rank->broadcast(rank_xfers[rank->rank_id()]);
+    }
+  }
+}
+
+bool Thread::retire(std::vector<rank::RankMessage *> &rank_messages) {
+  for (auto &rank_message : rank_messages) {
+    if (not rank_message->ack()) {
+      return false;
+    }
+  }
+
+  for (auto &rank_message : rank_messages) {
+    delete rank_message;
+  }
+  rank_messages.clear();
+
+  return true;
+}
+
 void Thread::init_dpu_transfer_pointer() {
   std::string bin_filepath = bindir_ + "/" + benchmark_ + "." +
                              std::to_string(num_tasklets_) +
@@ -1,7 +1,12 @@
 #ifndef UPMEM_SIM_SIMULATOR_CPU_THREAD_H_
 #define UPMEM_SIM_SIMULATOR_CPU_THREAD_H_
 
+#include <vector>
+
+#include "simulator/cpu/payload_archive.h"
 #include "simulator/dpu/dpu.h"
+#include "simulator/rank/rank.h"
+#include "simulator/rank/topology.h"
 
 namespace upmem_sim::simulator::cpu {
 
@@ -10,6 +15,11 @@ class Thread {
   explicit Thread(util::ArgumentParser *argument_parser);
   ~Thread() = default;
 
+  void connect_topology(rank::Topology *topology);
+  void connect_rank(rank::Rank *rank);
+  void connect_payload_archive(PayloadArchive *payload_archive);
+
+  std::string bindir() { return bindir_; }
   std::string benchmark() { return benchmark_; }
   int num_dpus() { return num_dpus_; }
   int num_tasklets() { return num_tasklets_; }
@@ -22,7 +32,18 @@ class Thread {
   int num_executions() { return num_executions_; }
 
  protected:
+  rank::Topology *topology() { return topology_; }
+  std::vector<rank::Rank *> ranks() { return ranks_; }
+  rank::Rank *rank(DPUID dpu_id);
+  dpu::DPU *dpu(DPUID dpu_id) { return rank(dpu_id)->dpu(dpu_id); }
+
   encoder::ByteStream *load_byte_stream(std::string filename);
+  encoder::ByteStream *load_payload(PayloadArchive::Kind kind, DPUID dpu_id,
+                                    int execution);
+
+  void push_xfer(std::vector<rank::RankMessage *> rank_messages);
+  void broadcast(std::vector<rank::RankMessage *> rank_messages);
+  bool retire(std::vector<rank::RankMessage *> &rank_messages);
 
   void init_dpu_transfer_pointer();
   void init_num_executions();
@@ -40,6 +61,11 @@ class Thread {
   Address sys_end_pointer_;
 
   int num_executions_;
+
+  rank::Topology *topology_;
+  std::vector<rank::Rank *> ranks_;
+
+  PayloadArchive *payload_archive_;
 };
 
 }  // namespace upmem_sim::simulator::cpu
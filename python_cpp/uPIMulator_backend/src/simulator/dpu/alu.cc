@@ -1,13 +1,41 @@
 #include "simulator/dpu/alu.h"
 
+#include <bit>
 #include <cassert>
-#include <cmath>
 #include <functional>
 
-#include "abi/word/data_word.h"
-
 namespace upmem_sim::simulator::dpu {
 
+namespace {
+
+// data words are 32 bits wide
+constexpr int width = 32;
+constexpr uint64_t word_mask = 0xFFFFFFFF;
+constexpr uint32_t sign_mask = uint32_t{1} << (width - 1);
+
+// operands are 32-bit words in either representation
+uint32_t word(int64_t operand) {
+  assert(-(int64_t{1} << (width - 1)) <= operand and
+         operand < (int64_t{1} << width));
+  return static_cast<uint32_t>(operand);
+}
+
+// shifts and rotations use the low 5 bits of the shift operand
+int shift_value(int64_t shift) { return static_cast<int>(word(shift) & 31); }
+
+bool sign_bit(uint32_t value) { return value >> (width - 1); }
+
+int64_t signed_slice(uint32_t value, int begin, int end) {
+  int slice_width = end - begin;
+  return static_cast<int32_t>(value << (width - end)) >> (width - slice_width);
+}
+
+int64_t unsigned_slice(uint32_t value, int begin, int end) {
+  return (value >> begin) & ((uint32_t{1} << (end - begin)) - 1);
+}
+
+}  // namespace
+
 int64_t ALU::atomic_address_hash(int64_t operand1, int64_t operand2) {
   assert(operand1 + operand2 < 256);
   auto [result, carry, overflow] = add(operand1, operand2);
@@ -20,396 +48,89 @@ std::tuple<int64_t, bool, bool> ALU::add(int64_t operand1, int64_t operand2) {
 
 std::tuple<int64_t, bool, bool> ALU::addc(int64_t operand1, int64_t operand2,
                                           bool carry_flag) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
+  uint32_t word1 = word(operand1);
+  uint32_t word2 = word(operand2);
 
-  int64_t result = data_word1->value(abi::word::UNSIGNED) +
-                   data_word2->value(abi::word::UNSIGNED) + carry_flag;
+  uint64_t sum = uint64_t{word1} + word2 + carry_flag;
+  auto result = static_cast<uint32_t>(sum);
 
-  int64_t max_unsigned_value =
-      static_cast<int64_t>(pow(2, abi::word::DataWord().width())) - 1;
-  bool carry;
-  if (result > max_unsigned_value) {
-    result %= static_cast<int64_t>(pow(2, abi::word::DataWord().width()));
-    carry = true;
-  } else {
-    carry = false;
-  }
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(result);
-
-  bool overflow;
-  if (data_word1->sign_bit() and data_word2->sign_bit() and
-      not result_data_word->sign_bit()) {
-    overflow = true;
-  } else if (not data_word1->sign_bit() and not data_word2->sign_bit() and
-             result_data_word->sign_bit()) {
-    overflow = true;
-  } else {
-    overflow = false;
-  }
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
+  bool carry = sum >> width;
+  // operands of equal sign whose sum has the other sign
+  bool overflow = sign_bit(~(word1 ^ word2) & (word1 ^ result));
 
   return {result, carry, overflow};
 }
 
 std::tuple<int64_t, bool, bool> ALU::sub(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  int64_t result;
-  bool carry;
-  if (data_word1->value(abi::word::UNSIGNED) >=
-      data_word2->value(abi::word::UNSIGNED)) {
-    result = data_word1->value(abi::word::UNSIGNED) -
-             data_word2->value(abi::word::UNSIGNED);
-    carry = false;
-  } else {
-    result = static_cast<int64_t>(pow(2, abi::word::DataWord().width())) +
-             data_word1->value(abi::word::UNSIGNED) -
-             data_word2->value(abi::word::UNSIGNED);
-    carry = true;
-  }
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(result);
+  uint32_t word1 = word(operand1);
+  uint32_t word2 = word(operand2);
 
-  bool overflow;
-  if (data_word1->sign_bit() and not data_word2->sign_bit() and
-      result_data_word->sign_bit()) {
-    overflow = true;
-  } else if (not data_word1->sign_bit() and data_word2->sign_bit() and
-             not result_data_word->sign_bit()) {
-    overflow = true;
-  } else {
-    overflow = false;
-  }
+  uint32_t result = word1 - word2;
 
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
+  bool carry = word1 < word2;
+  // operands of different sign whose difference keeps the sign of operand1
+  bool overflow = sign_bit((word1 ^ word2) & ~(word1 ^ result));
 
   return {result, carry, overflow};
 }
 
 std::tuple<int64_t, bool, bool> ALU::subc(int64_t operand1, int64_t operand2,
                                           bool carry_flag) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  int64_t result;
-  bool carry;
-  if (data_word1->value(abi::word::UNSIGNED) + carry_flag >=
-      data_word2->value(abi::word::UNSIGNED)) {
-    result = data_word1->value(abi::word::UNSIGNED) -
-             data_word2->value(abi::word::UNSIGNED) - carry_flag;
-    carry = false;
-  } else {
-    result = static_cast<int64_t>(pow(2, abi::word::DataWord().width())) +
-             data_word1->value(abi::word::UNSIGNED) -
-             data_word2->value(abi::word::UNSIGNED) - carry_flag;
-    carry = true;
-  }
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(result);
+  uint32_t word1 = word(operand1);
+  uint32_t word2 = word(operand2);
 
-  bool overflow;
-  if (data_word1->sign_bit() and not data_word2->sign_bit() and
-      result_data_word->sign_bit()) {
-    overflow = true;
-  } else if (not data_word1->sign_bit() and data_word2->sign_bit() and
-             not result_data_word->sign_bit()) {
-    overflow = true;
-  } else {
-    overflow = false;
-  }
+  // the borrow test compares word1 + carry_flag against word2, so with the
+  // carry set the difference can dip to -2 without wrapping
+  bool carry = int64_t{word1} + carry_flag < int64_t{word2};
+  int64_t result = int64_t{word1} - word2 - carry_flag +
+                   (static_cast<int64_t>(carry) << width);
 
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
+  auto result_word = static_cast<uint32_t>(result);
+  bool overflow = sign_bit((word1 ^ word2) & ~(word1 ^ result_word));
 
   return {result, carry, overflow};
 }
 
 int64_t ALU::and_(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (data_word1->bit(i) and data_word2->bit(i)) {
-      result_data_word->set_bit(i);
-    } else {
-      result_data_word->clear_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return word(operand1) & word(operand2);
 }
 
 int64_t ALU::nand(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (data_word1->bit(i) and data_word2->bit(i)) {
-      result_data_word->clear_bit(i);
-    } else {
-      result_data_word->set_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return static_cast<uint32_t>(~(word(operand1) & word(operand2)));
 }
 
 int64_t ALU::andn(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (not data_word1->bit(i) and data_word2->bit(i)) {
-      result_data_word->set_bit(i);
-    } else {
-      result_data_word->clear_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return ~word(operand1) & word(operand2);
 }
 
 int64_t ALU::or_(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (data_word1->bit(i) or data_word2->bit(i)) {
-      result_data_word->set_bit(i);
-    } else {
-      result_data_word->clear_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return word(operand1) | word(operand2);
 }
 
 int64_t ALU::nor(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (data_word1->bit(i) or data_word2->bit(i)) {
-      result_data_word->clear_bit(i);
-    } else {
-      result_data_word->set_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return static_cast<uint32_t>(~(word(operand1) | word(operand2)));
 }
 
 int64_t ALU::orn(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (not data_word1->bit(i) or data_word2->bit(i)) {
-      result_data_word->set_bit(i);
-    } else {
-      result_data_word->clear_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return ~word(operand1) | word(operand2);
 }
 
 int64_t ALU::xor_(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (not data_word1->bit(i) and data_word2->bit(i)) {
-      result_data_word->set_bit(i);
-    } else if (data_word1->bit(i) and not data_word2->bit(i)) {
-      result_data_word->set_bit(i);
-    } else {
-      result_data_word->clear_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return word(operand1) ^ word(operand2);
 }
 
 int64_t ALU::nxor(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (not data_word1->bit(i) and data_word2->bit(i)) {
-      result_data_word->clear_bit(i);
-    } else if (data_word1->bit(i) and not data_word2->bit(i)) {
-      result_data_word->clear_bit(i);
-    } else {
-      result_data_word->set_bit(i);
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return static_cast<uint32_t>(~(word(operand1) ^ word(operand2)));
 }
 
 int64_t ALU::asr(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-  bool msb = data_word->sign_bit();
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i + shift_value >= result_data_word->width()) {
-      if (msb) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    } else {
-      if (data_word->bit(static_cast<int>(i + shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-
-  int64_t result = data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  // the shifted word has always been discarded and the operand returned as is;
+  // kept bit-exact here
+  return word(operand);
 }
 
 int64_t ALU::lsl(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i < shift_value) {
-      result_data_word->clear_bit(i);
-    } else {
-      if (data_word->bit(static_cast<int>(i - shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  return word(operand) << shift_value(shift);
 }
 
 std::tuple<int64_t, bool, bool> ALU::lsl_add(int64_t operand1, int64_t operand2,
@@ -423,32 +144,9 @@ std::tuple<int64_t, bool, bool> ALU::lsl_sub(int64_t operand1, int64_t operand2,
 }
 
 int64_t ALU::lsl1(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i < shift_value) {
-      result_data_word->set_bit(i);
-    } else {
-      if (data_word->bit(static_cast<int>(i - shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  int shift_amount = shift_value(shift);
+  return (word(operand) << shift_amount) |
+         static_cast<uint32_t>((uint64_t{1} << shift_amount) - 1);
 }
 
 int64_t ALU::lsl1x(int64_t operand, int64_t shift) {
@@ -456,43 +154,16 @@ int64_t ALU::lsl1x(int64_t operand, int64_t shift) {
 }
 
 int64_t ALU::lslx(int64_t operand, int64_t shift) {
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  if (shift_value == 0) {
+  int shift_amount = shift_value(shift);
+  if (shift_amount == 0) {
     return 0;
   } else {
-    return lsr(operand, abi::word::DataWord().width() - shift_value);
+    return lsr(operand, width - shift_amount);
   }
 }
 
 int64_t ALU::lsr(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i + shift_value >= result_data_word->width()) {
-      result_data_word->clear_bit(i);
-    } else {
-      if (data_word->bit(static_cast<int>(i + shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  return word(operand) >> shift_value(shift);
 }
 
 std::tuple<int64_t, bool, bool> ALU::lsr_add(int64_t operand1, int64_t operand2,
@@ -501,32 +172,9 @@ std::tuple<int64_t, bool, bool> ALU::lsr_add(int64_t operand1, int64_t operand2,
 }
 
 int64_t ALU::lsr1(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i + shift_value >= result_data_word->width()) {
-      result_data_word->set_bit(i);
-    } else {
-      if (data_word->bit(static_cast<int>(i + shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  int shift_amount = shift_value(shift);
+  return (word(operand) >> shift_amount) |
+         static_cast<uint32_t>(~(word_mask >> shift_amount));
 }
 
 int64_t ALU::lsr1x(int64_t operand, int64_t shift) {
@@ -534,49 +182,16 @@ int64_t ALU::lsr1x(int64_t operand, int64_t shift) {
 }
 
 int64_t ALU::lsrx(int64_t operand, int64_t shift) {
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  if (shift_value == 0) {
+  int shift_amount = shift_value(shift);
+  if (shift_amount == 0) {
     return 0;
   } else {
-    return lsl(operand, abi::word::DataWord().width() - shift_value);
+    return lsl(operand, width - shift_amount);
   }
 }
 
 int64_t ALU::rol(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i < shift_value) {
-      if (data_word->bit(
-              static_cast<int>(i + data_word->width() - shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    } else {
-      if (data_word->bit(static_cast<int>(i - shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  return std::rotl(word(operand), shift_value(shift));
 }
 
 std::tuple<int64_t, bool, bool> ALU::rol_add(int64_t operand1, int64_t operand2,
@@ -585,402 +200,107 @@ std::tuple<int64_t, bool, bool> ALU::rol_add(int64_t operand1, int64_t operand2,
 }
 
 int64_t ALU::ror(int64_t operand, int64_t shift) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto shift_data_word = new abi::word::DataWord();
-  shift_data_word->set_value(shift);
-  auto shift_value = shift_data_word->bit_slice(abi::word::UNSIGNED, 0, 5);
-
-  auto result_data_word = new abi::word::DataWord();
-  for (int i = 0; i < result_data_word->width(); i++) {
-    if (i + shift_value >= result_data_word->width()) {
-      if (data_word->bit(
-              static_cast<int>((i + shift_value) % data_word->width()))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    } else {
-      if (data_word->bit(static_cast<int>(i + shift_value))) {
-        result_data_word->set_bit(i);
-      } else {
-        result_data_word->clear_bit(i);
-      }
-    }
-  }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete result_data_word;
-
-  return result;
+  return std::rotr(word(operand), shift_value(shift));
 }
 
-int64_t ALU::cao(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  int64_t ones = 0;
-  for (int i = 0; i < data_word->width(); i++) {
-    if (data_word->bit(i)) {
-      ones += 1;
-    }
-  }
+int64_t ALU::cao(int64_t operand) { return std::popcount(word(operand)); }
 
-  delete data_word;
-
-  return ones;
-}
-
-int64_t ALU::clo(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  int64_t leading_ones = 0;
-  for (int i = 0; i < data_word->width(); i++) {
-    if (data_word->bit(data_word->width() - 1 - i)) {
-      leading_ones += 1;
-    } else {
-      break;
-    }
-  }
-  delete data_word;
-
-  return leading_ones;
-}
+int64_t ALU::clo(int64_t operand) { return std::countl_one(word(operand)); }
 
 int64_t ALU::cls(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  bool msb = data_word->sign_bit();
-  int64_t leading_sign_bits = 0;
-  for (int i = 0; i < data_word->width(); i++) {
-    if (data_word->bit(data_word->width() - 1 - i) == msb) {
-      leading_sign_bits += 1;
-    } else {
-      break;
-    }
-  }
-
-  delete data_word;
-  return leading_sign_bits;
+  uint32_t value = word(operand);
+  return sign_bit(value) ? std::countl_one(value) : std::countl_zero(value);
 }
 
-int64_t ALU::clz(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  int64_t leading_zeros = 0;
-  for (int i = 0; i < data_word->width(); i++) {
-    if (not data_word->bit(data_word->width() - 1 - i)) {
-      leading_zeros += 1;
-    } else {
-      break;
-    }
-  }
-
-  delete data_word;
-
-  return leading_zeros;
-}
+int64_t ALU::clz(int64_t operand) { return std::countl_zero(word(operand)); }
 
 int64_t ALU::cmpb4(int64_t operand1, int64_t operand2) {
-  assert(abi::word::DataWord().width() == 4 * 8);
+  uint32_t equal_bytes = ~(word(operand1) ^ word(operand2));
 
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
+  uint32_t result = 0;
   for (int i = 0; i < 4; i++) {
-    int begin = 8 * i;
-    int end = 8 * (i + 1);
-
-    int64_t byte1 = data_word1->bit_slice(abi::word::UNSIGNED, begin, end);
-    int64_t byte2 = data_word2->bit_slice(abi::word::UNSIGNED, begin, end);
-
-    if (byte1 == byte2) {
-      result_data_word->set_bit_slice(begin, end, 1);
-    } else {
-      result_data_word->set_bit_slice(begin, end, 0);
-    }
+    result |= static_cast<uint32_t>(((equal_bytes >> (8 * i)) & 0xFF) == 0xFF)
+              << (8 * i);
   }
-
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete result_data_word;
-
   return result;
 }
 
 int64_t ALU::extsb(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-  int64_t result = data_word->bit_slice(abi::word::SIGNED, 0, 8);
-  delete data_word;
-  return result;
+  return signed_slice(word(operand), 0, 8);
 }
 
 int64_t ALU::extsh(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-  int64_t result = data_word->bit_slice(abi::word::SIGNED, 0, 16);
-  delete data_word;
-  return result;
+  return signed_slice(word(operand), 0, 16);
 }
 
 int64_t ALU::extub(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-  int64_t result = data_word->bit_slice(abi::word::UNSIGNED, 0, 8);
-  delete data_word;
-  return result;
+  return unsigned_slice(word(operand), 0, 8);
 }
 
 int64_t ALU::extuh(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-  int64_t result = data_word->bit_slice(abi::word::UNSIGNED, 0, 16);
-  delete data_word;
-  return result;
+  return unsigned_slice(word(operand), 0, 16);
 }
 
-int64_t ALU::mul_sh_sh(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
+// products of two bytes always fit a data word, so they are returned as is
 
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::SIGNED, 8, 16) *
-                              data_word2->bit_slice(abi::word::SIGNED, 8, 16));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+int64_t ALU::mul_sh_sh(int64_t operand1, int64_t operand2) {
+  return signed_slice(word(operand1), 8, 16) *
+         signed_slice(word(operand2), 8, 16);
 }
 
 int64_t ALU::mul_sh_sl(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::SIGNED, 8, 16) *
-                              data_word2->bit_slice(abi::word::UNSIGNED, 0, 8));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 8, 16) *
+         unsigned_slice(word(operand2), 0, 8);
 }
 
 int64_t ALU::mul_sh_uh(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(
-      data_word1->bit_slice(abi::word::SIGNED, 8, 16) *
-      data_word2->bit_slice(abi::word::UNSIGNED, 8, 16));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 8, 16) *
+         unsigned_slice(word(operand2), 8, 16);
 }
 
 int64_t ALU::mul_sh_ul(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::SIGNED, 8, 16) *
-                              data_word2->bit_slice(abi::word::UNSIGNED, 0, 8));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 8, 16) *
+         unsigned_slice(word(operand2), 0, 8);
 }
 
 int64_t ALU::mul_sl_sh(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::SIGNED, 0, 8) *
-                              data_word2->bit_slice(abi::word::SIGNED, 8, 16));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 0, 8) *
+         signed_slice(word(operand2), 8, 16);
 }
 
 int64_t ALU::mul_sl_sl(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::SIGNED, 0, 8) *
-                              data_word2->bit_slice(abi::word::SIGNED, 0, 8));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 0, 8) *
+         signed_slice(word(operand2), 0, 8);
 }
 
 int64_t ALU::mul_sl_uh(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(
-      data_word1->bit_slice(abi::word::SIGNED, 0, 8) *
-      data_word2->bit_slice(abi::word::UNSIGNED, 8, 16));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 0, 8) *
+         unsigned_slice(word(operand2), 8, 16);
 }
 
 int64_t ALU::mul_sl_ul(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::SIGNED, 0, 8) *
-                              data_word2->bit_slice(abi::word::UNSIGNED, 0, 8));
-  int64_t result = result_data_word->value(abi::word::SIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return signed_slice(word(operand1), 0, 8) *
+         unsigned_slice(word(operand2), 0, 8);
 }
 
 int64_t ALU::mul_uh_uh(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(
-      data_word1->bit_slice(abi::word::UNSIGNED, 8, 16) *
-      data_word2->bit_slice(abi::word::UNSIGNED, 8, 16));
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return unsigned_slice(word(operand1), 8, 16) *
+         unsigned_slice(word(operand2), 8, 16);
 }
 
 int64_t ALU::mul_uh_ul(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(
-      data_word1->bit_slice(abi::word::UNSIGNED, 8, 16) *
-      data_word2->bit_slice(abi::word::UNSIGNED, 0, 8));
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return unsigned_slice(word(operand1), 8, 16) *
+         unsigned_slice(word(operand2), 0, 8);
 }
 
 int64_t ALU::mul_ul_uh(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(
-      data_word1->bit_slice(abi::word::UNSIGNED, 0, 8) *
-      data_word2->bit_slice(abi::word::UNSIGNED, 8, 16));
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return unsigned_slice(word(operand1), 0, 8) *
+         unsigned_slice(word(operand2), 8, 16);
 }
 
 int64_t ALU::mul_ul_ul(int64_t operand1, int64_t operand2) {
-  auto data_word1 = new abi::word::DataWord();
-  data_word1->set_value(operand1);
-
-  auto data_word2 = new abi::word::DataWord();
-  data_word2->set_value(operand2);
-
-  auto result_data_word = new abi::word::DataWord();
-  result_data_word->set_value(data_word1->bit_slice(abi::word::UNSIGNED, 0, 8) *
-                              data_word2->bit_slice(abi::word::UNSIGNED, 0, 8));
-  int64_t result = result_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word1;
-  delete data_word2;
-  delete result_data_word;
-
-  return result;
+  return unsigned_slice(word(operand1), 0, 8) *
+         unsigned_slice(word(operand2), 0, 8);
 }
 
 int64_t ALU::sats(int64_t operand) { throw std::bad_function_call(); }
@@ -990,43 +310,13 @@ int64_t ALU::hash(int64_t operand1, int64_t operand2) {
 }
 
 std::tuple<int64_t, int64_t> ALU::signed_extension(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto even_data_word = new abi::word::DataWord();
-  if (data_word->sign_bit()) {
-    even_data_word->set_value(-1);
-  }
-  int64_t even = even_data_word->value(abi::word::UNSIGNED);
-
-  auto odd_data_word = new abi::word::DataWord();
-  odd_data_word->set_value(data_word->value(abi::word::UNSIGNED));
-  int64_t odd = odd_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete even_data_word;
-  delete odd_data_word;
-
-  return {even, odd};
+  uint32_t value = word(operand);
+  int64_t even = sign_bit(value) ? word_mask : 0;
+  return {even, value};
 }
 
 std::tuple<int64_t, int64_t> ALU::unsigned_extension(int64_t operand) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(operand);
-
-  auto even_data_word = new abi::word::DataWord();
-  even_data_word->set_value(0);
-  int64_t even = even_data_word->value(abi::word::UNSIGNED);
-
-  auto odd_data_word = new abi::word::DataWord();
-  odd_data_word->set_value(data_word->value(abi::word::UNSIGNED));
-  int64_t odd = odd_data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-  delete even_data_word;
-  delete odd_data_word;
-
-  return {even, odd};
+  return {0, word(operand)};
 }
 
 }  // namespace upmem_sim::simulator::dpu
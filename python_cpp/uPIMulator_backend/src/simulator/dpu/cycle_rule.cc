@@ -1,5 +1,7 @@
 #include "simulator/dpu/cycle_rule.h"
 
+#include <algorithm>
+
 namespace upmem_sim::simulator::dpu {
 
 CycleRule::CycleRule(util::ArgumentParser *argument_parser)
@@ -39,11 +41,45 @@ util::StatFactory *CycleRule::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree *CycleRule::stat_tree() {
+  return new util::StatTree(stat_factory_);
+}
+
 void CycleRule::push(abi::instruction::Instruction *instruction) {
   assert(instruction != nullptr);
   input_q_->push(instruction);
 }
 
+void CycleRule::fingerprint(std::vector<int64_t> *fingerprint) {
+  for (auto q : {input_q_, ready_q_}) {
+    std::vector<abi::instruction::Instruction *> instructions = q->items();
+    fingerprint->push_back(static_cast<int64_t>(instructions.size()));
+    for (auto &instruction : instructions) {
+      fingerprint->push_back(reinterpret_cast<intptr_t>(instruction));
+    }
+  }
+
+  fingerprint->push_back(wait_q_->size());
+  for (auto &[instruction, timer] : wait_q_->items()) {
+    fingerprint->push_back(reinterpret_cast<intptr_t>(instruction));
+    // an item is ready once its timer reaches 0, however far below
+    fingerprint->push_back(std::max(timer, 0));
+  }
+
+  for (auto gp_regs : {&prev_write_gp_regs_, &cur_read_gp_regs_}) {
+    for (auto &thread_gp_regs : *gp_regs) {
+      std::vector<int64_t> indices;
+      for (auto &gp_reg : thread_gp_regs) {
+        indices.push_back(gp_reg->index());
+      }
+      std::sort(indices.begin(), indices.end());
+
+      fingerprint->push_back(static_cast<int64_t>(indices.size()));
+      fingerprint->insert(fingerprint->end(), indices.begin(), indices.end());
+    }
+  }
+}
+
 void CycleRule::cycle() {
   service_input_q();
   service_ready_q();
@@ -58,6 +94,8 @@ void CycleRule::service_input_q() {
 
     wait_q_->push(instruction, extra_cycle);
 
+    instruction->thread()->add_cycle_rule_cycles(extra_cycle);
+
     stat_factory_->increment("cycle_rule", extra_cycle);
     stat_factory_->increment(
         std::to_string(instruction->thread()->id()) + "_cycle_rule",
@@ -6,6 +6,7 @@
 #include "simulator/basic/timer_queue.h"
 #include "util/argument_parser.h"
 #include "util/stat_factory.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dpu {
 
@@ -15,6 +16,7 @@ class CycleRule {
   ~CycleRule();
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
 
   bool empty() {
     return input_q_->empty() and wait_q_->empty() and ready_q_->empty();
@@ -25,6 +27,11 @@ class CycleRule {
   abi::instruction::Instruction *pop() { return ready_q_->pop(); }
   void cycle();
 
+  // appends the queued instructions, their remaining cycles and the registers
+  // each tasklet's next instruction is checked against
+  void fingerprint(std::vector<int64_t> *fingerprint);
+  util::StatFactory *live_stat_factory() { return stat_factory_; }
+
  protected:
   void service_input_q();
   void service_ready_q();
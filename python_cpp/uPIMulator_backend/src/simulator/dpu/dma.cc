@@ -44,13 +44,15 @@ void DMA::transfer_to_atomic(Address address,
 
 void DMA::transfer_to_iram(Address address, encoder::ByteStream *byte_stream) {
   assert(address == iram_->address());
-  assert(byte_stream->size() % abi::word::InstructionWord().size() == 0);
+  constexpr Address instruction_size =
+      util::ConfigLoader::iram_data_width() / 8;
+  assert(byte_stream->size() % instruction_size == 0);
 
-  int num_instructions = static_cast<int>(byte_stream->size() /
-                                          abi::word::InstructionWord().size());
+  int num_instructions =
+      static_cast<int>(byte_stream->size() / instruction_size);
   for (int i = 0; i < num_instructions; i++) {
-    Address begin = i * abi::word::InstructionWord().size();
-    Address end = (i + 1) * abi::word::InstructionWord().size();
+    Address begin = i * instruction_size;
+    Address end = (i + 1) * instruction_size;
 
     encoder::ByteStream *instruction_byte_stream =
         byte_stream->slice(static_cast<int>(begin), static_cast<int>(end));
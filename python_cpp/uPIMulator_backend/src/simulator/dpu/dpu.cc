@@ -1,20 +1,21 @@
 #include "simulator/dpu/dpu.h"
 
-#include <cmath>
 #include <iostream>
 
 namespace upmem_sim::simulator::dpu {
 
-DPU::DPU(DPUID dpu_id, util::ArgumentParser *argument_parser)
+DPU::DPU(DPUID dpu_id, dram::PagePool *page_pool,
+         util::ArgumentParser *argument_parser)
     : dpu_id_(dpu_id),
       atomic_(new sram::Atomic()),
       iram_(new sram::IRAM()),
       wram_(new sram::WRAM()),
-      mram_(new dram::MRAM(argument_parser)),
+      mram_(new dram::MRAM(page_pool, argument_parser)),
       logic_(new Logic(dpu_id, argument_parser)),
       dma_(new DMA()),
       operand_collector_(new OperandCollector()),
       memory_controller_(new dram::MemoryController(argument_parser)),
+      host_timer_(nullptr),
       stat_factory_(new util::StatFactory("DPU#" + std::to_string(dpu_id))) {
   int num_threads =
       static_cast<int>(argument_parser->get_int_parameter("num_tasklets"));
@@ -44,12 +45,9 @@ DPU::DPU(DPUID dpu_id, util::ArgumentParser *argument_parser)
 
   memory_controller_->connect_mram(mram_);
 
-  logic_frequency_ =
-      static_cast<int>(argument_parser->get_int_parameter("logic_frequency"));
-  memory_frequency_ =
-      static_cast<int>(argument_parser->get_int_parameter("memory_frequency"));
-  frequency_ratio_ = static_cast<double>(memory_frequency_) /
-                     static_cast<double>(logic_frequency_);
+  memory_clock_ = new basic::ClockDomain(
+      argument_parser->get_int_parameter("memory_frequency"),
+      argument_parser->get_int_parameter("logic_frequency"));
 }
 
 DPU::~DPU() {
@@ -66,24 +64,29 @@ DPU::~DPU() {
   delete dma_;
   delete operand_collector_;
   delete memory_controller_;
+  delete memory_clock_;
 
   delete stat_factory_;
 }
 
+void DPU::connect_host_timer(util::HostProfiler::Timer *host_timer) {
+  assert(host_timer != nullptr);
+  assert(host_timer_ == nullptr);
+
+  host_timer_ = host_timer;
+  memory_controller_->connect_host_timer(host_timer);
+}
+
 util::StatFactory *DPU::stat_factory() {
+  logic_->finish_spin();
+
   auto stat_factory = new util::StatFactory("");
 
   util::StatFactory *logic_stat_factory = logic_->stat_factory();
   util::StatFactory *memory_stat_factory = memory_controller_->stat_factory();
 
-  for (auto &thread : threads_) {
-    std::map<ThreadStatus, int64_t> status_tracker = thread->status_tracker();
-    for (const auto &stat : status_tracker) {
-      stat_factory_->increment(
-          std::to_string(thread->id()) + "_latency_breakdown_" + stat.first,
-          stat.second);
-    }
-  }
+  update_cycle();
+  update_latency_breakdown();
 
   stat_factory->merge(stat_factory_);
   stat_factory->merge(logic_stat_factory);
@@ -95,6 +98,34 @@ util::StatFactory *DPU::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree *DPU::stat_tree() {
+  logic_->finish_spin();
+  update_cycle();
+  update_latency_breakdown();
+
+  auto stat_tree = new util::StatTree(stat_factory_);
+  stat_tree->add_child(logic_->stat_tree());
+  stat_tree->add_child(memory_controller_->stat_tree());
+  return stat_tree;
+}
+
+void DPU::update_cycle() {
+  stat_factory_->overwrite("cycle", memory_clock_->reference_cycle());
+}
+
+void DPU::update_latency_breakdown() {
+  // status trackers hold running totals; overwrite so that repeated snapshots
+  // stay idempotent
+  for (auto &thread : threads_) {
+    std::map<ThreadStatus, int64_t> status_tracker = thread->status_tracker();
+    for (const auto &stat : status_tracker) {
+      stat_factory_->overwrite(
+          std::to_string(thread->id()) + "_latency_breakdown_" + stat.first,
+          stat.second);
+    }
+  }
+}
+
 bool DPU::is_zombie() {
   for (auto &thread : threads_) {
     if (thread->state() != Thread::ZOMBIE) {
@@ -105,20 +136,34 @@ bool DPU::is_zombie() {
   return logic_->empty() and memory_controller_->empty();
 }
 
+bool DPU::is_idle() {
+  for (auto &thread : threads_) {
+    if (thread->state() != Thread::EMBRYO and
+        thread->state() != Thread::ZOMBIE) {
+      return false;
+    }
+  }
+
+  return logic_->empty() and memory_controller_->empty();
+}
+
 void DPU::cycle() {
-  scheduler_->cycle();
-  logic_->cycle();
+  if (host_timer_ != nullptr) {
+    host_timer_->start();
+  }
+
+  if (not logic_->skip_spin_cycle()) {
+    scheduler_->cycle();
+    lap(util::HostProfiler::SCHEDULER);
+    logic_->cycle();
+  }
+  lap(util::HostProfiler::LOGIC);
   dma_->cycle();
-  int num_memory_cycles = static_cast<int>(
-      floor(frequency_ratio_ *
-            static_cast<double>(stat_factory_->value("cycle"))) -
-      floor(frequency_ratio_ *
-            static_cast<double>(stat_factory_->value("cycle") - 1)));
+  lap(util::HostProfiler::DMA);
+  int num_memory_cycles = memory_clock_->tick();
   for (int i = 0; i < num_memory_cycles; i++) {
     memory_controller_->cycle();
   }
-
-  stat_factory_->increment("cycle");
 }
 
 }  // namespace upmem_sim::simulator::dpu
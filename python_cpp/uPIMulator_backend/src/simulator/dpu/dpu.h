@@ -1,6 +1,7 @@
 #ifndef UPMEM_SIM_SIMULATOR_DPU_DPU_H_
 #define UPMEM_SIM_SIMULATOR_DPU_DPU_H_
 
+#include "simulator/basic/clock_domain.h"
 #include "simulator/dpu/dma.h"
 #include "simulator/dpu/logic.h"
 #include "simulator/dpu/operand_collector.h"
@@ -10,13 +11,16 @@
 #include "simulator/sram/iram.h"
 #include "simulator/sram/wram.h"
 #include "util/argument_parser.h"
+#include "util/host_profiler.h"
 #include "util/stat_factory.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dpu {
 
 class DPU {
  public:
-  explicit DPU(DPUID dpu_id, util::ArgumentParser *argument_parser);
+  explicit DPU(DPUID dpu_id, dram::PagePool *page_pool,
+               util::ArgumentParser *argument_parser);
   ~DPU();
 
   DPUID dpu_id() { return dpu_id_; }
@@ -24,12 +28,42 @@ class DPU {
   RevolverScheduler *scheduler() { return scheduler_; }
   DMA *dma() { return dma_; }
 
+  void connect_trace_ring(tracer::TraceRing *trace_ring) {
+    logic_->connect_trace_ring(trace_ring);
+  }
+  void connect_probe(observer::Probe *probe) {
+    logic_->connect_probe(probe);
+    memory_controller_->connect_probe(probe);
+  }
+  void connect_block_library(translator::BlockLibrary *block_library) {
+    logic_->connect_block_library(block_library);
+  }
+  void connect_host_timer(util::HostProfiler::Timer *host_timer);
+
+  SimTime num_cycles() { return memory_clock_->reference_cycle(); }
+  int64_t num_instructions() { return logic_->num_instructions(); }
+  Thread *issued_thread() { return logic_->issued_thread(); }
+  Address issued_pc() { return logic_->issued_pc(); }
+
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
 
   bool is_zombie();
+  bool is_idle();
   void boot() { scheduler_->boot(0); }
+  void share_mram() { mram_->share(); }
   void cycle();
 
+ protected:
+  void update_cycle();
+  void update_latency_breakdown();
+
+  void lap(util::HostProfiler::Component component) {
+    if (host_timer_ != nullptr) {
+      host_timer_->lap(component);
+    }
+  }
+
  private:
   DPUID dpu_id_;
 
@@ -45,9 +79,10 @@ class DPU {
   OperandCollector *operand_collector_;
   dram::MemoryController *memory_controller_;
 
-  int logic_frequency_;
-  int memory_frequency_;
-  double frequency_ratio_;
+  // memory controller cycles against logic cycles
+  basic::ClockDomain *memory_clock_;
+
+  util::HostProfiler::Timer *host_timer_;
 
   util::StatFactory *stat_factory_;
 };
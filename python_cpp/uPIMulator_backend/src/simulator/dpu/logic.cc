@@ -6,6 +6,7 @@
 
 #include "converter/instruction_converter.h"
 #include "converter/reg_file_converter.h"
+#include "abi/word/instruction_word.h"
 #include "simulator/dpu/alu.h"
 
 namespace upmem_sim::simulator::dpu {
@@ -13,6 +14,7 @@ namespace upmem_sim::simulator::dpu {
 Logic::~Logic() {
   delete pipeline_;
   delete cycle_rule_;
+  delete sync_tracker_;
   delete wait_instruction_q_;
 
   delete stat_factory_;
@@ -24,17 +26,28 @@ util::StatFactory *Logic::stat_factory() {
   util::StatFactory *cycle_rule_stat_factory = cycle_rule_->stat_factory();
   util::StatFactory *scheduler_stat_factory =
       scheduler_->stat_factory();
+  util::StatFactory *sync_tracker_stat_factory = sync_tracker_->stat_factory();
 
   stat_factory->merge(stat_factory_);
   stat_factory->merge(cycle_rule_stat_factory);
   stat_factory->merge(scheduler_stat_factory);
+  stat_factory->merge(sync_tracker_stat_factory);
 
   delete cycle_rule_stat_factory;
   delete scheduler_stat_factory;
+  delete sync_tracker_stat_factory;
 
   return stat_factory;
 }
 
+util::StatTree *Logic::stat_tree() {
+  auto stat_tree = new util::StatTree(stat_factory_);
+  stat_tree->add_child(cycle_rule_->stat_tree());
+  stat_tree->add_child(scheduler_->stat_tree());
+  stat_tree->add_child(sync_tracker_->stat_tree());
+  return stat_tree;
+}
+
 void Logic::connect_scheduler(RevolverScheduler *scheduler) {
   assert(scheduler != nullptr);
   assert(scheduler_ == nullptr);
@@ -70,10 +83,33 @@ void Logic::connect_dma(DMA *dma) {
   dma_ = dma;
 }
 
+void Logic::connect_trace_ring(tracer::TraceRing *trace_ring) {
+  assert(trace_ring != nullptr);
+  assert(trace_ring_ == nullptr);
+
+  trace_ring_ = trace_ring;
+}
+
+void Logic::connect_probe(observer::Probe *probe) {
+  assert(probe != nullptr);
+  assert(probe_ == nullptr);
+
+  probe_ = probe;
+}
+
+void Logic::connect_block_library(translator::BlockLibrary *block_library) {
+  assert(block_library != nullptr);
+  assert(block_library_ == nullptr);
+
+  block_library_ = block_library;
+}
+
 void Logic::cycle() {
-  stat_factory_->overwrite("mram_address", -1);        
-  stat_factory_->overwrite("mram_access_thread", -1);  
-  stat_factory_->overwrite("mram_access_size", -1); 
+  if (probe_ != nullptr) {
+    probe_->set_cycle(cycle_);
+  }
+  spin_event_ = false;
+  spin_failed_acquire_ = false;
 
   service_scheduler();
 
@@ -87,17 +123,41 @@ void Logic::cycle() {
   cycle_rule_->cycle();
 
   stat_factory_->increment("logic_cycle");
+  cycle_ += 1;
+
+  if (spin_fast_forward_ and not spin_catch_up_) {
+    detect_spin();
+  }
+}
+
+bool Logic::skip_spin_cycle() {
+  if (not spin_skipping_) {
+    return false;
+  }
+
+  if (not(wait_instruction_q_->can_pop() and dma_->can_pop())) {
+    spin_offset_ += 1;
+    return true;
+  }
+
+  // a DMA completes this cycle; the skipped part of the period had none
+  finish_spin();
+  return false;
 }
 
 void Logic::service_scheduler() {
+  issued_thread_ = nullptr;
+
   if (pipeline_->can_push() and cycle_rule_->can_push() and
       wait_instruction_q_->can_push()) {
     // if (pipeline_->can_push() and wait_instruction_q_->can_push()) {
     Thread *thread = scheduler_->schedule();
     if (thread != nullptr) {
       int chosen_thread_id = thread->id();
+      issued_thread_ = thread;
+      issued_pc_ = thread->reg_file()->read_pc_reg();
       abi::instruction::Instruction *instruction =
-          iram_->read(thread->reg_file()->read_pc_reg());
+          iram_->read(thread->id(), issued_pc_);
       instruction->set_thread(thread);
       pipeline_->push(instruction);
 
@@ -107,12 +167,24 @@ void Logic::service_scheduler() {
           std::cout << converter::InstructionConverter::to_string(instruction) << std::endl;
         }
         
-        execute_instruction(instruction);
+        if (trace_ring_ == nullptr) {
+          if (block_library_ == nullptr or verbose_ >= 2 or
+              not execute_translated(instruction)) {
+            execute_instruction(instruction);
+          }
+        } else {
+          trace_instruction(instruction);
+        }
 
         if (verbose_ >= 2) {
           std::cout << converter::RegFileConverter::to_string(instruction->thread()->reg_file()) << std::endl;
         }
+
+        if (not spin_failed_acquire_ and not is_spin_pure(instruction)) {
+          spin_event_ = true;
+        }
       } else {
+        spin_event_ = true;
         scheduler_->block(thread->id());
         instruction->thread()->reg_file()->increment_pc_reg();
         wait_instruction_q_->push(instruction);
@@ -177,14 +249,16 @@ void Logic::service_cycle_rule() {
   if (cycle_rule_->can_pop()) {
     abi::instruction::Instruction *instruction = cycle_rule_->pop();
 
-    if (instruction->suffix() != abi::instruction::DMA_RRI) {
-      delete instruction;
-    } else {
+    if (instruction->suffix() == abi::instruction::DMA_RRI) {
       if (verbose_ >= 1) {
         std::cout << "{" << dpu_id_ << "}";
         std::cout << converter::InstructionConverter::to_string(instruction) << std::endl;
       }
-      execute_instruction(instruction);
+      if (trace_ring_ == nullptr) {
+        execute_instruction(instruction);
+      } else {
+        trace_instruction(instruction);
+      }
 
       if (verbose_ >= 2) {
         std::cout << converter::RegFileConverter::to_string(instruction->thread()->reg_file()) << std::endl;
@@ -196,16 +270,28 @@ void Logic::service_cycle_rule() {
 void Logic::service_logic() {}
 
 void Logic::service_dma() {
-  if (wait_instruction_q_->can_pop() and dma_->can_pop()) {
+  if (not spin_catch_up_ and wait_instruction_q_->can_pop() and
+      dma_->can_pop()) {
+    spin_event_ = true;
+
     DMACommand *dma_command = dma_->pop();
     abi::instruction::Instruction *instruction = wait_instruction_q_->pop();
 
     assert(dma_command->instruction() == instruction);
 
+    if (probe_ != nullptr) {
+      probe_->dma_complete(
+          instruction->thread()->id(),
+          dma_command->operation() == DMACommand::READ
+              ? observer::DMAEvent::READ
+              : observer::DMAEvent::WRITE,
+          dma_command->wram_address(), dma_command->mram_address(),
+          dma_command->size());
+    }
+
     scheduler_->awake(instruction->thread()->id());
 
     delete dma_command;
-    delete instruction;
   }
 }
 
@@ -375,6 +461,95 @@ void Logic::execute_instruction(abi::instruction::Instruction *instruction) {
   }
 }
 
+void Logic::trace_instruction(abi::instruction::Instruction *instruction) {
+  reg::RegFile *reg_file = instruction->thread()->reg_file();
+
+  tracer::TraceRecord record{};
+  record.cycle = cycle_;
+  record.dpu_id = dpu_id_;
+  record.pc = reg_file->read_pc_reg();
+  if (instruction->suffix() == abi::instruction::DMA_RRI) {
+    // DMA instructions retire after the PC has moved past them
+    record.pc -= util::ConfigLoader::iram_data_width() / 8;
+  }
+  record.thread_id = instruction->thread()->id();
+  record.op_code = instruction->op_code();
+  record.suffix = instruction->suffix();
+
+  if (instruction->has_ra()) {
+    record.operand_mask |= tracer::TraceRecord::RA;
+    record.ra = reg_file->read_src_reg(instruction->ra(), abi::word::UNSIGNED);
+  }
+  if (instruction->has_rb()) {
+    record.operand_mask |= tracer::TraceRecord::RB;
+    record.rb = reg_file->read_src_reg(instruction->rb(), abi::word::UNSIGNED);
+  }
+  if (instruction->has_imm()) {
+    record.operand_mask |= tracer::TraceRecord::IMM;
+    record.imm = static_cast<int32_t>(instruction->imm()->value());
+  } else if (instruction->has_off()) {
+    record.operand_mask |= tracer::TraceRecord::IMM;
+    record.imm = static_cast<int32_t>(instruction->off()->value());
+  }
+
+  Thread *thread = instruction->thread();
+  std::array<int64_t, 3> stall_cycles = {
+      thread->status_tracker()["WAIT_DATA"],
+      thread->status_tracker()["WAIT_SCHEDULE"], thread->cycle_rule_cycles()};
+  std::array<int64_t, 3> &traced_stall_cycles =
+      traced_stall_cycles_[thread->id()];
+  record.wait_data_cycles = stall_cycles[0] - traced_stall_cycles[0];
+  record.wait_schedule_cycles = stall_cycles[1] - traced_stall_cycles[1];
+  record.cycle_rule_cycles = stall_cycles[2] - traced_stall_cycles[2];
+  traced_stall_cycles = stall_cycles;
+
+  execute_instruction(instruction);
+
+  if (instruction->has_rc()) {
+    record.num_reg_deltas = 1;
+    record.reg_delta_indices[0] = instruction->rc()->index();
+    record.reg_delta_values[0] =
+        reg_file->read_gp_reg(instruction->rc(), abi::word::UNSIGNED);
+  } else if (instruction->has_dc()) {
+    auto [even, odd] =
+        reg_file->read_pair_reg(instruction->dc(), abi::word::UNSIGNED);
+    record.num_reg_deltas = 2;
+    record.reg_delta_indices[0] = instruction->dc()->even_reg()->index();
+    record.reg_delta_indices[1] = instruction->dc()->odd_reg()->index();
+    record.reg_delta_values[0] = even;
+    record.reg_delta_values[1] = odd;
+  }
+
+  trace_ring_->push(record);
+}
+
+bool Logic::execute_translated(abi::instruction::Instruction *instruction) {
+  // a translated block runs whole when its first instruction issues; the rest
+  // of its instructions still issue and are timed, but only step the pc
+  reg::RegFile *reg_file = instruction->thread()->reg_file();
+  Address &translated_end_pc = translated_end_pcs_[instruction->thread()->id()];
+  if (issued_pc_ < translated_end_pc) {
+    reg_file->increment_pc_reg();
+    return true;
+  }
+  translated_end_pc = -1;
+
+  upmem_translated_block block = block_library_->block_at(issued_pc_);
+  if (block == nullptr) {
+    return false;
+  }
+
+  upmem_translated_state state;
+  reg_file->save(&state);
+  block(&state);
+  reg_file->restore(&state);
+  reg_file->increment_pc_reg();
+  translated_end_pc = state.pc;
+
+  stat_factory_->increment("translated_blocks");
+  return true;
+}
+
 void Logic::execute_rici(abi::instruction::Instruction *instruction) {
   assert(abi::instruction::Instruction::rici_op_codes().count(
       instruction->op_code()));
@@ -409,9 +584,18 @@ void Logic::execute_acquire_rici(abi::instruction::Instruction *instruction) {
     atomic_->acquire(atomic_address, instruction->thread()->id());
   }
 
+  sync_tracker_->acquire(cycle_, instruction->thread()->id(), atomic_address,
+                         can_acquire);
+  spin_failed_acquire_ = not can_acquire;
+
   instruction->thread()->reg_file()->clear_conditions();
   set_acquire_cc(instruction, not can_acquire);
 
+  if (probe_ != nullptr) {
+    probe_->lock_acquire(instruction->thread()->id(), atomic_address,
+                         can_acquire);
+  }
+
   if (instruction->thread()->reg_file()->condition(instruction->condition())) {
     instruction->thread()->reg_file()->write_pc_reg(instruction->pc()->value());
   } else {
@@ -440,12 +624,21 @@ void Logic::execute_release_rici(abi::instruction::Instruction *instruction) {
   instruction->thread()->reg_file()->clear_conditions();
   set_acquire_cc(instruction, not can_release);
 
+  if (probe_ != nullptr) {
+    probe_->lock_release(instruction->thread()->id(), atomic_address,
+                         can_release);
+  }
+
   if (instruction->thread()->reg_file()->condition(instruction->condition())) {
     instruction->thread()->reg_file()->write_pc_reg(instruction->pc()->value());
   } else {
     instruction->thread()->reg_file()->increment_pc_reg();
   }
 
+  sync_tracker_->release(cycle_, instruction->thread()->id(), atomic_address,
+                         can_release,
+                         instruction->thread()->reg_file()->read_pc_reg());
+
   set_flags(instruction, not can_release, false);
 }
 
@@ -468,6 +661,9 @@ void Logic::execute_boot_rici(abi::instruction::Instruction *instruction) {
     set_flags(instruction, not can_boot, false);
   } else if (op_code == abi::instruction::RESUME) {
     bool can_resume = scheduler_->awake(static_cast<ThreadID>(thread_id));
+    if (can_resume) {
+      sync_tracker_->resume(cycle_, static_cast<ThreadID>(thread_id));
+    }
     set_boot_cc(instruction, ra, not can_resume);
     set_flags(instruction, not can_resume, false);
   } else {
@@ -600,14 +796,14 @@ void Logic::execute_call_rri(abi::instruction::Instruction *instruction) {
     std::tie(result, carry, overflow) = ALU::add(ra, imm);
   } else {
     std::tie(result, carry, overflow) =
-        ALU::add(ra * abi::word::InstructionWord().size(), imm);
+        ALU::add(ra * util::ConfigLoader::iram_data_width() / 8, imm);
   }
 
   instruction->thread()->reg_file()->clear_conditions();
 
   Address pc = instruction->thread()->reg_file()->read_pc_reg();
   instruction->thread()->reg_file()->write_gp_reg(
-      instruction->rc(), pc + abi::word::InstructionWord().size());
+      instruction->rc(), pc + util::ConfigLoader::iram_data_width() / 8);
 
   instruction->thread()->reg_file()->write_pc_reg(result);
 
@@ -1226,7 +1422,7 @@ void Logic::execute_rrr(abi::instruction::Instruction *instruction) {
   if (op_code == abi::instruction::CALL) {
     Address pc = instruction->thread()->reg_file()->read_pc_reg();
     instruction->thread()->reg_file()->write_gp_reg(
-        instruction->rc(), pc + abi::word::InstructionWord().size());
+        instruction->rc(), pc + util::ConfigLoader::iram_data_width() / 8);
     instruction->thread()->reg_file()->write_pc_reg(result);
   } else {
     instruction->thread()->reg_file()->write_gp_reg(instruction->rc(), result);
@@ -1875,7 +2071,7 @@ void Logic::execute_call_zri(abi::instruction::Instruction *instruction) {
     std::tie(result, carry, overflow) = ALU::add(ra, imm);
   } else {
     std::tie(result, carry, overflow) =
-        ALU::add(ra * abi::word::InstructionWord().size(), imm);
+        ALU::add(ra * util::ConfigLoader::iram_data_width() / 8, imm);
   }
 
   instruction->thread()->reg_file()->clear_conditions();
@@ -4679,6 +4875,8 @@ void Logic::execute_ci(abi::instruction::Instruction *instruction) {
       instruction->op_code()));
   assert(instruction->suffix() == abi::instruction::CI);
 
+  Address pc = instruction->thread()->reg_file()->read_pc_reg();
+
   instruction->thread()->reg_file()->clear_conditions();
   if (instruction->thread()->reg_file()->condition(instruction->condition())) {
     instruction->thread()->reg_file()->write_pc_reg(instruction->pc()->value());
@@ -4687,6 +4885,7 @@ void Logic::execute_ci(abi::instruction::Instruction *instruction) {
     instruction->thread()->reg_file()->increment_pc_reg();
     scheduler_->sleep(instruction->thread()->id());
   }
+  sync_tracker_->stop(cycle_, instruction->thread()->id(), pc);
 }
 
 void Logic::execute_i(abi::instruction::Instruction *instruction) {
@@ -4782,6 +4981,11 @@ void Logic::execute_erri(abi::instruction::Instruction *instruction) {
     throw std::invalid_argument("");
   }
 
+  if (probe_ != nullptr) {
+    probe_->wram_load(instruction->thread()->id(), address,
+                      access_size(op_code));
+  }
+
   instruction->thread()->reg_file()->clear_conditions();
   instruction->thread()->reg_file()->write_gp_reg(instruction->rc(), result);
   instruction->thread()->reg_file()->increment_pc_reg();
@@ -4815,6 +5019,11 @@ void Logic::execute_edri(abi::instruction::Instruction *instruction) {
     throw std::invalid_argument("");
   }
 
+  if (probe_ != nullptr) {
+    probe_->wram_load(instruction->thread()->id(), address,
+                      access_size(op_code));
+  }
+
   instruction->thread()->reg_file()->clear_conditions();
   instruction->thread()->reg_file()->write_pair_reg(instruction->dc(), even,
                                                     odd);
@@ -4857,6 +5066,11 @@ void Logic::execute_erii(abi::instruction::Instruction *instruction) {
     throw std::invalid_argument("");
   }
 
+  if (probe_ != nullptr) {
+    probe_->wram_store(instruction->thread()->id(), address,
+                       access_size(op_code));
+  }
+
   instruction->thread()->reg_file()->clear_conditions();
   instruction->thread()->reg_file()->increment_pc_reg();
 }
@@ -4890,6 +5104,11 @@ void Logic::execute_erir(abi::instruction::Instruction *instruction) {
     throw std::invalid_argument("");
   }
 
+  if (probe_ != nullptr) {
+    probe_->wram_store(instruction->thread()->id(), address,
+                       access_size(op_code));
+  }
+
   instruction->thread()->reg_file()->clear_conditions();
   instruction->thread()->reg_file()->increment_pc_reg();
 
@@ -4916,6 +5135,11 @@ void Logic::execute_erid(abi::instruction::Instruction *instruction) {
     throw std::invalid_argument("");
   }
 
+  if (probe_ != nullptr) {
+    probe_->wram_store(instruction->thread()->id(), address,
+                       access_size(op_code));
+  }
+
   instruction->thread()->reg_file()->clear_conditions();
   instruction->thread()->reg_file()->increment_pc_reg();
 }
@@ -4971,10 +5195,10 @@ void Logic::execute_ldma(abi::instruction::Instruction *instruction) {
   dma_->transfer_from_mram_to_wram(wram_address, mram_address, size,
                                    instruction);
 
-  stat_factory_->overwrite("mram_address", mram_address); 
-  stat_factory_->overwrite("mram_access_thread",
-                           instruction->thread()->id());
-  stat_factory_->overwrite("mram_access_size", size); 
+  if (probe_ != nullptr) {
+    probe_->dma_issue(instruction->thread()->id(), observer::DMAEvent::READ,
+                      wram_address, mram_address, size);
+  }
 
   instruction->thread()->reg_file()->clear_conditions();
 }
@@ -5015,10 +5239,10 @@ void Logic::execute_sdma(abi::instruction::Instruction *instruction) {
   dma_->transfer_from_wram_to_mram(wram_address, mram_address, size,
                                    instruction);
 
-  stat_factory_->overwrite("mram_address", mram_address);
-  stat_factory_->overwrite("mram_access_thread",
-                           instruction->thread()->id());
-  stat_factory_->overwrite("mram_access_size", size); 
+  if (probe_ != nullptr) {
+    probe_->dma_issue(instruction->thread()->id(), observer::DMAEvent::WRITE,
+                      wram_address, mram_address, size);
+  }
 
   instruction->thread()->reg_file()->clear_conditions();
 }
@@ -5167,7 +5391,7 @@ void Logic::set_count_nz_cc(abi::instruction::Instruction *instruction,
     instruction->thread()->reg_file()->set_condition(abi::isa::SMI);
   }
 
-  if (result == abi::word::DataWord().width()) {
+  if (result == util::ConfigLoader::mram_data_width()) {
     instruction->thread()->reg_file()->set_condition(abi::isa::MAX);
   } else {
     instruction->thread()->reg_file()->set_condition(abi::isa::NMAX);
@@ -5598,4 +5822,224 @@ void Logic::set_flags(abi::instruction::Instruction *instruction,
   }
 }
 
+Address Logic::access_size(abi::instruction::OpCode op_code) {
+  if (op_code == abi::instruction::LBS or op_code == abi::instruction::LBU or
+      op_code == abi::instruction::SB or op_code == abi::instruction::SB_ID) {
+    return 1;
+  } else if (op_code == abi::instruction::LHS or
+             op_code == abi::instruction::LHU or
+             op_code == abi::instruction::SH or
+             op_code == abi::instruction::SH_ID) {
+    return 2;
+  } else if (op_code == abi::instruction::LW or
+             op_code == abi::instruction::SW or
+             op_code == abi::instruction::SW_ID) {
+    return 4;
+  } else if (op_code == abi::instruction::LD or
+             op_code == abi::instruction::SD or
+             op_code == abi::instruction::SD_ID) {
+    return 8;
+  } else {
+    throw std::invalid_argument("");
+  }
+}
+
+bool Logic::is_spin_pure(abi::instruction::Instruction *instruction) {
+  // syncs, stops, WRAM accesses and DMAs reach state outside the tasklet
+  abi::instruction::Suffix suffix = instruction->suffix();
+  return suffix != abi::instruction::RICI and
+         suffix != abi::instruction::CI and suffix != abi::instruction::I and
+         suffix != abi::instruction::ERRI and
+         suffix != abi::instruction::S_ERRI and
+         suffix != abi::instruction::U_ERRI and
+         suffix != abi::instruction::EDRI and
+         suffix != abi::instruction::ERII and
+         suffix != abi::instruction::ERIR and
+         suffix != abi::instruction::ERID and
+         suffix != abi::instruction::DMA_RRI;
+}
+
+std::vector<util::StatFactory *> Logic::spin_stat_factories() {
+  return {stat_factory_, cycle_rule_->live_stat_factory(),
+          scheduler_->live_stat_factory()};
+}
+
+std::vector<int64_t> Logic::spin_fingerprint() {
+  std::vector<int64_t> fingerprint;
+
+  for (auto &thread : scheduler_->threads()) {
+    thread->reg_file()->fingerprint(&fingerprint);
+  }
+  scheduler_->fingerprint(&fingerprint);
+  pipeline_->fingerprint(&fingerprint);
+  cycle_rule_->fingerprint(&fingerprint);
+  sync_tracker_->fingerprint(&fingerprint);
+
+  std::vector<abi::instruction::Instruction *> instructions =
+      wait_instruction_q_->items();
+  fingerprint.push_back(static_cast<int64_t>(instructions.size()));
+  for (auto &instruction : instructions) {
+    fingerprint.push_back(reinterpret_cast<intptr_t>(instruction));
+  }
+  fingerprint.insert(fingerprint.end(), translated_end_pcs_.begin(),
+                     translated_end_pcs_.end());
+
+  return fingerprint;
+}
+
+Logic::SpinSnapshot Logic::spin_snapshot() {
+  SpinSnapshot snapshot;
+
+  snapshot.fingerprint = spin_fingerprint();
+  for (auto &stat_factory : spin_stat_factories()) {
+    snapshot.stats.push_back(stat_factory->values());
+  }
+  for (auto &thread : scheduler_->threads()) {
+    snapshot.thread_statuses.push_back(thread->status_tracker());
+    snapshot.cycle_rule_cycles.push_back(thread->cycle_rule_cycles());
+    snapshot.issue_cycles.push_back(thread->issue_cycle());
+  }
+  snapshot.num_failures = sync_tracker_->num_failures();
+
+  return snapshot;
+}
+
+void Logic::detect_spin() {
+  if (spin_event_ or probe_ != nullptr or trace_ring_ != nullptr) {
+    reset_spin();
+    return;
+  }
+
+  if (spin_period_ > 0) {
+    if (spin_skipping_ or not spin_failed_acquire_ or
+        cycle_ != spin_verify_cycle_) {
+      return;
+    }
+
+    // one period on from the snapshot the whole logic side must be back where
+    // it was; only then are the counters it advanced repeatable
+    SpinSnapshot snapshot = spin_snapshot();
+    if (snapshot.fingerprint != spin_snapshot_.fingerprint) {
+      reset_spin();
+      return;
+    }
+
+    spin_delta_ = SpinSnapshot();
+    for (int i = 0; i < static_cast<int>(snapshot.stats.size()); i++) {
+      std::map<std::string, int64_t> &stats = spin_delta_.stats.emplace_back();
+      for (auto &[stat, value] : snapshot.stats[i]) {
+        int64_t delta = value - spin_snapshot_.stats[i][stat];
+        if (delta != 0) {
+          stats[stat] = delta;
+        }
+      }
+    }
+    for (int i = 0; i < static_cast<int>(snapshot.thread_statuses.size());
+         i++) {
+      std::map<ThreadStatus, int64_t> &statuses =
+          spin_delta_.thread_statuses.emplace_back();
+      for (auto &[status, value] : snapshot.thread_statuses[i]) {
+        statuses[status] = value - spin_snapshot_.thread_statuses[i][status];
+      }
+      spin_delta_.cycle_rule_cycles.push_back(
+          snapshot.cycle_rule_cycles[i] - spin_snapshot_.cycle_rule_cycles[i]);
+      spin_delta_.issue_cycles.push_back(snapshot.issue_cycles[i] -
+                                         spin_snapshot_.issue_cycles[i]);
+    }
+    for (int i = 0; i < static_cast<int>(snapshot.num_failures.size()); i++) {
+      spin_delta_.num_failures.push_back(snapshot.num_failures[i] -
+                                         spin_snapshot_.num_failures[i]);
+    }
+
+    spin_skipping_ = true;
+    spin_offset_ = 0;
+    return;
+  }
+
+  // only the failed acquires of one tasklet are candidates, which keeps the
+  // fingerprints to one per round of the spinning tasklets
+  if (not spin_failed_acquire_) {
+    return;
+  } else if (spin_lead_thread_ == -1) {
+    spin_lead_thread_ = issued_thread_->id();
+  } else if (issued_thread_->id() != spin_lead_thread_) {
+    return;
+  }
+
+  std::vector<int64_t> fingerprint = spin_fingerprint();
+  size_t hash = 0;
+  for (auto &value : fingerprint) {
+    hash = hash * 1000003 ^ std::hash<int64_t>()(value);
+  }
+
+  auto history = spin_history_.find(hash);
+  if (history != spin_history_.end()) {
+    spin_period_ = cycle_ - history->second;
+    spin_verify_cycle_ = cycle_ + spin_period_;
+    spin_snapshot_ = spin_snapshot();
+    spin_history_.clear();
+    return;
+  }
+
+  if (spin_history_.size() >= 64) {
+    spin_history_.clear();
+  }
+  spin_history_[hash] = cycle_;
+}
+
+void Logic::advance_spin_periods(int64_t num_periods) {
+  std::vector<util::StatFactory *> stat_factories = spin_stat_factories();
+  for (int i = 0; i < static_cast<int>(stat_factories.size()); i++) {
+    for (auto &[stat, value] : spin_delta_.stats[i]) {
+      stat_factories[i]->increment(stat, value * num_periods);
+    }
+  }
+
+  std::vector<Thread *> threads = scheduler_->threads();
+  for (int i = 0; i < static_cast<int>(threads.size()); i++) {
+    for (auto &[status, value] : spin_delta_.thread_statuses[i]) {
+      threads[i]->update_thread_status(status, value * num_periods);
+    }
+    threads[i]->add_cycle_rule_cycles(spin_delta_.cycle_rule_cycles[i] *
+                                      num_periods);
+    threads[i]->add_issue_cycles(
+        static_cast<int>(spin_delta_.issue_cycles[i] * num_periods));
+  }
+
+  std::vector<int64_t> num_failures;
+  for (auto &num_failure : spin_delta_.num_failures) {
+    num_failures.push_back(num_failure * num_periods);
+  }
+  sync_tracker_->add_failures(num_failures);
+
+  cycle_ += spin_period_ * num_periods;
+  stat_factory_->increment("spin_skipped_cycle", spin_period_ * num_periods);
+}
+
+void Logic::finish_spin() {
+  if (not spin_skipping_) {
+    return;
+  }
+
+  advance_spin_periods(spin_offset_ / spin_period_);
+
+  // the cycles skipped into the unfinished period are run for real
+  spin_catch_up_ = true;
+  for (SimTime i = spin_offset_ % spin_period_; i > 0; i--) {
+    scheduler_->cycle();
+    cycle();
+  }
+  spin_catch_up_ = false;
+
+  reset_spin();
+}
+
+void Logic::reset_spin() {
+  spin_lead_thread_ = -1;
+  spin_history_.clear();
+  spin_period_ = 0;
+  spin_skipping_ = false;
+  spin_offset_ = 0;
+}
+
 }  // namespace upmem_sim::simulator::dpu
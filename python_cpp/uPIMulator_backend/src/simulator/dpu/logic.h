@@ -1,17 +1,27 @@
 #ifndef UPMEM_SIM_SIMULATOR_DPU_LOGIC_H_
 #define UPMEM_SIM_SIMULATOR_DPU_LOGIC_H_
 
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
 #include "simulator/dpu/cycle_rule.h"
 #include "simulator/dpu/dma.h"
 #include "simulator/dpu/operand_collector.h"
 #include "simulator/dpu/pipeline.h"
 #include "simulator/dpu/revolver_scheduler.h"
+#include "simulator/dpu/sync_tracker.h"
 #include "simulator/dram/memory_controller.h"
+#include "simulator/observer/probe.h"
 #include "simulator/sram/atomic.h"
 #include "simulator/sram/iram.h"
 #include "simulator/sram/wram.h"
+#include "tracer/trace_ring.h"
+#include "translator/block_library.h"
 #include "util/argument_parser.h"
 #include "util/stat_factory.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dpu {
 
@@ -26,31 +36,81 @@ class Logic {
         dma_(nullptr),
         pipeline_(new Pipeline(argument_parser)),
         cycle_rule_(new CycleRule(argument_parser)),
+        sync_tracker_(new SyncTracker()),
         operand_collector_(nullptr),
         wait_instruction_q_(new basic::Queue<abi::instruction::Instruction>(
             util::ConfigLoader::max_num_tasklets())),
         stat_factory_(new util::StatFactory("Logic")),
         num_pipeline_stages_(
-            argument_parser->get_int_parameter("num_pipeline_stages")) {}
+            argument_parser->get_int_parameter("num_pipeline_stages")),
+        trace_ring_(nullptr),
+        traced_stall_cycles_(util::ConfigLoader::max_num_tasklets()),
+        block_library_(nullptr),
+        translated_end_pcs_(util::ConfigLoader::max_num_tasklets(), -1),
+        probe_(nullptr),
+        issued_thread_(nullptr),
+        issued_pc_(0),
+        cycle_(0),
+        spin_fast_forward_(
+            argument_parser->get_int_parameter("spin_fast_forward") != 0 and
+            verbose_ == 0 and
+            argument_parser->get_int_parameter("stats_interval") == 0 and
+            argument_parser->get_int_parameter("host_profile_interval") == 0 and
+            argument_parser->get_int_parameter("lockstep_profile") == 0),
+        spin_event_(false),
+        spin_failed_acquire_(false),
+        spin_lead_thread_(-1),
+        spin_period_(0),
+        spin_verify_cycle_(0),
+        spin_skipping_(false),
+        spin_offset_(0),
+        spin_catch_up_(false) {}
   ~Logic();
 
   DPUID dpu_id() { return dpu_id_; }
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
+  int64_t num_instructions() {
+    return stat_factory_->value("num_instructions");
+  }
 
   void connect_scheduler(RevolverScheduler *scheduler);
   void connect_atomic(sram::Atomic *atomic);
   void connect_iram(sram::IRAM *iram);
   void connect_operand_collector(OperandCollector *operand_collector);
   void connect_dma(DMA *dma);
+  void connect_trace_ring(tracer::TraceRing *trace_ring);
+  void connect_probe(observer::Probe *probe);
+  void connect_block_library(translator::BlockLibrary *block_library);
+
+  // thread issued in the last cycle (nullptr if none) and the pc it issued
+  Thread *issued_thread() { return issued_thread_; }
+  Address issued_pc() { return issued_pc_; }
 
   bool empty() {
     return pipeline_->empty() and cycle_rule_->empty() and
            wait_instruction_q_->empty();
   }
   void cycle();
+  // true if this cycle lies in a fast-forwarded spin period, in which case
+  // neither the scheduler nor the logic cycles
+  bool skip_spin_cycle();
+  // settles the skipped cycles, for stats read in the middle of a spin
+  void finish_spin();
 
  protected:
+  // the logic side at a failed acquire: state a period has to reproduce, and
+  // the counters it advances
+  struct SpinSnapshot {
+    std::vector<int64_t> fingerprint;
+    std::vector<std::map<std::string, int64_t>> stats;
+    std::vector<std::map<ThreadStatus, int64_t>> thread_statuses;
+    std::vector<int64_t> cycle_rule_cycles;
+    std::vector<int64_t> issue_cycles;
+    std::vector<int64_t> num_failures;
+  };
+
   void service_scheduler();
   void service_pipeline();
   void service_cycle_rule();
@@ -58,6 +118,8 @@ class Logic {
   void service_dma();
 
   void execute_instruction(abi::instruction::Instruction *instruction);
+  void trace_instruction(abi::instruction::Instruction *instruction);
+  bool execute_translated(abi::instruction::Instruction *instruction);
 
   void execute_rici(abi::instruction::Instruction *instruction);
   void execute_acquire_rici(abi::instruction::Instruction *instruction);
@@ -289,6 +351,16 @@ class Logic {
   void set_flags(abi::instruction::Instruction *instruction, int64_t result,
                  bool carry);
 
+  static Address access_size(abi::instruction::OpCode op_code);
+
+  static bool is_spin_pure(abi::instruction::Instruction *instruction);
+  std::vector<util::StatFactory *> spin_stat_factories();
+  std::vector<int64_t> spin_fingerprint();
+  SpinSnapshot spin_snapshot();
+  void detect_spin();
+  void advance_spin_periods(int64_t num_periods);
+  void reset_spin();
+
  private:
   DPUID dpu_id_;
   int verbose_;
@@ -301,11 +373,44 @@ class Logic {
   Pipeline *pipeline_;
   int num_pipeline_stages_;
   CycleRule *cycle_rule_;
+  SyncTracker *sync_tracker_;
   OperandCollector *operand_collector_;
 
   basic::Queue<abi::instruction::Instruction> *wait_instruction_q_;
 
   util::StatFactory *stat_factory_;
+
+  tracer::TraceRing *trace_ring_;
+  // per thread: WAIT_DATA, WAIT_SCHEDULE and cycle rule cycles when the
+  // thread was last traced
+  std::vector<std::array<int64_t, 3>> traced_stall_cycles_;
+  translator::BlockLibrary *block_library_;
+  // per thread: pc right after the translated block it is issuing through,
+  // -1 outside of one
+  std::vector<Address> translated_end_pcs_;
+  observer::Probe *probe_;
+  Thread *issued_thread_;
+  Address issued_pc_;
+  SimTime cycle_;
+
+  bool spin_fast_forward_;
+  // this cycle issued anything but arithmetic or a failed acquire, or
+  // completed a DMA
+  bool spin_event_;
+  bool spin_failed_acquire_;
+  ThreadID spin_lead_thread_;
+  // fingerprint hash -> cycle of the failed acquires since the last event
+  std::map<size_t, SimTime> spin_history_;
+  // 0 unless a period is being verified or skipped
+  SimTime spin_period_;
+  SimTime spin_verify_cycle_;
+  SpinSnapshot spin_snapshot_;
+  // counters one period advances
+  SpinSnapshot spin_delta_;
+  bool spin_skipping_;
+  // cycles skipped so far, settled by finish_spin
+  SimTime spin_offset_;
+  bool spin_catch_up_;
 };
 
 }  // namespace upmem_sim::simulator::dpu
@@ -4,6 +4,12 @@
 
 namespace upmem_sim::simulator::dpu {
 
+namespace {
+
+constexpr Address data_word_size = util::ConfigLoader::wram_data_width() / 8;
+
+}  // namespace
+
 void OperandCollector::connect_wram(sram::WRAM *wram) {
   assert(wram != nullptr);
   assert(wram_ == nullptr);
@@ -12,123 +18,64 @@ void OperandCollector::connect_wram(sram::WRAM *wram) {
 }
 
 int64_t OperandCollector::lbs(Address address) {
-  Address data_word_size = abi::word::DataWord().size();
-  Address base_address = (address / data_word_size) * data_word_size;
-  Address offset = address % data_word_size;
-
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(wram_->read(base_address));
-
-  int64_t result =
-      data_word->bit_slice(abi::word::SIGNED, static_cast<int>(8 * offset),
-                           static_cast<int>(8 * (offset + 1)));
-
-  delete data_word;
-
-  return result;
+  return static_cast<int8_t>(lbu(address));
 }
 
 int64_t OperandCollector::lbu(Address address) {
-  Address data_word_size = abi::word::DataWord().size();
   Address base_address = (address / data_word_size) * data_word_size;
   Address offset = address % data_word_size;
 
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(wram_->read(base_address));
-
-  int64_t result =
-      data_word->bit_slice(abi::word::UNSIGNED, static_cast<int>(8 * offset),
-                           static_cast<int>(8 * (offset + 1)));
-
-  delete data_word;
-
-  return result;
+  return (wram_->read(base_address) >> (8 * offset)) & 0xFF;
 }
 
 int64_t OperandCollector::lhs(Address address) {
-  auto data_word = new abi::word::DataWord();
-
-  data_word->set_bit_slice(0, 8, lbs(address));
-  data_word->set_bit_slice(8, 16, lbs(address + 1));
-
-  int64_t result = data_word->bit_slice(abi::word::SIGNED, 0, 16);
-
-  delete data_word;
-
-  return result;
+  return static_cast<int16_t>(lhu(address));
 }
 
 int64_t OperandCollector::lhu(Address address) {
-  auto data_word = new abi::word::DataWord();
-
-  data_word->set_bit_slice(0, 8, lbu(address));
-  data_word->set_bit_slice(8, 16, lbu(address + 1));
-
-  int64_t result = data_word->bit_slice(abi::word::UNSIGNED, 0, 16);
-
-  delete data_word;
-
-  return result;
+  return lbu(address) | (lbu(address + 1) << 8);
 }
 
 int64_t OperandCollector::lw(Address address) {
-  auto data_word = new abi::word::DataWord();
-
-  data_word->set_bit_slice(0, 8, lbu(address));
-  data_word->set_bit_slice(8, 16, lbu(address + 1));
-  data_word->set_bit_slice(16, 24, lbu(address + 2));
-  data_word->set_bit_slice(24, 32, lbu(address + 3));
-
-  int64_t result = data_word->value(abi::word::UNSIGNED);
-
-  delete data_word;
-
-  return result;
+  return lbu(address) | (lbu(address + 1) << 8) | (lbu(address + 2) << 16) |
+         (lbu(address + 3) << 24);
 }
 
 std::tuple<int64_t, int64_t> OperandCollector::ld(Address address) {
-  return {lw(address + abi::word::DataWord().size()), lw(address)};
+  return {lw(address + data_word_size), lw(address)};
 }
 
 void OperandCollector::sb(Address address, int64_t value) {
-  Address data_word_size = abi::word::DataWord().size();
+  assert(-128 <= value and value < 256);
+
   Address base_address = (address / data_word_size) * data_word_size;
   Address offset = address % data_word_size;
 
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(wram_->read(base_address));
-  data_word->set_bit_slice(static_cast<int>(8 * offset),
-                           static_cast<int>(8 * (offset + 1)), value);
+  int64_t data_word = wram_->read(base_address);
+  data_word &= ~(int64_t{0xFF} << (8 * offset));
+  data_word |= (value & 0xFF) << (8 * offset);
 
-  wram_->write(base_address, data_word->value(abi::word::UNSIGNED));
-
-  delete data_word;
+  wram_->write(base_address, data_word);
 }
 
 void OperandCollector::sh(Address address, int64_t value) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(value);
-
-  sb(address, data_word->bit_slice(abi::word::UNSIGNED, 0, 8));
-  sb(address + 1, data_word->bit_slice(abi::word::UNSIGNED, 8, 16));
+  assert(-(int64_t{1} << 31) <= value and value < (int64_t{1} << 32));
 
-  delete data_word;
+  sb(address, value & 0xFF);
+  sb(address + 1, (value >> 8) & 0xFF);
 }
 
 void OperandCollector::sw(Address address, int64_t value) {
-  auto data_word = new abi::word::DataWord();
-  data_word->set_value(value);
-
-  sb(address, data_word->bit_slice(abi::word::UNSIGNED, 0, 8));
-  sb(address + 1, data_word->bit_slice(abi::word::UNSIGNED, 8, 16));
-  sb(address + 2, data_word->bit_slice(abi::word::UNSIGNED, 16, 24));
-  sb(address + 3, data_word->bit_slice(abi::word::UNSIGNED, 24, 32));
+  assert(-(int64_t{1} << 31) <= value and value < (int64_t{1} << 32));
 
-  delete data_word;
+  sb(address, value & 0xFF);
+  sb(address + 1, (value >> 8) & 0xFF);
+  sb(address + 2, (value >> 16) & 0xFF);
+  sb(address + 3, (value >> 24) & 0xFF);
 }
 
 void OperandCollector::sd(Address address, int64_t even, int64_t odd) {
-  sw(address + abi::word::DataWord().size(), even);
+  sw(address + data_word_size, even);
   sw(address, odd);
 }
 
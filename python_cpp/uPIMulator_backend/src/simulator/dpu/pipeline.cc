@@ -44,6 +44,16 @@ void Pipeline::push(abi::instruction::Instruction *instruction) {
   input_q_->push(instruction);
 }
 
+void Pipeline::fingerprint(std::vector<int64_t> *fingerprint) {
+  for (auto q : {input_q_, wait_q_, ready_q_}) {
+    std::vector<abi::instruction::Instruction *> instructions = q->items();
+    fingerprint->push_back(static_cast<int64_t>(instructions.size()));
+    for (auto &instruction : instructions) {
+      fingerprint->push_back(reinterpret_cast<intptr_t>(instruction));
+    }
+  }
+}
+
 void Pipeline::cycle() {
   service_input_q();
   service_wait_q();
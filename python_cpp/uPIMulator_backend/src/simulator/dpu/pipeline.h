@@ -1,6 +1,8 @@
 #ifndef UPMEM_SIM_SIMULATOR_DPU_PIPELINE_H_
 #define UPMEM_SIM_SIMULATOR_DPU_PIPELINE_H_
 
+#include <vector>
+
 #include "abi/instruction/instruction.h"
 #include "simulator/basic/queue.h"
 #include "util/argument_parser.h"
@@ -21,6 +23,9 @@ class Pipeline {
   abi::instruction::Instruction *pop() { return ready_q_->pop(); }
   void cycle();
 
+  // appends the instruction in every stage, bubbles as 0
+  void fingerprint(std::vector<int64_t> *fingerprint);
+
  protected:
   bool empty_input_q() { return input_q_->empty(); }
   bool empty_wait_q();
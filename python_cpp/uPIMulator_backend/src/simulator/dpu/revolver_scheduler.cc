@@ -1,5 +1,7 @@
 #include "simulator/dpu/revolver_scheduler.h"
 
+#include <algorithm>
+
 namespace upmem_sim::simulator::dpu {
 
 RevolverScheduler::RevolverScheduler(util::ArgumentParser *argument_parser,
@@ -32,6 +34,10 @@ util::StatFactory *RevolverScheduler::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree *RevolverScheduler::stat_tree() {
+  return new util::StatTree(stat_factory_);
+}
+
 Thread *RevolverScheduler::schedule() {
   bool is_blocked = false;
   for (int i = 0; i < thread_q_->size(); i++) {
@@ -60,6 +66,21 @@ Thread *RevolverScheduler::schedule() {
   return nullptr;
 }
 
+void RevolverScheduler::fingerprint(std::vector<int64_t> *fingerprint) {
+  fingerprint->push_back(thread_q_->front()->id());
+  for (auto &thread : threads_) {
+    fingerprint->push_back(thread->state());
+    // only a runnable thread resets its issue cycle; the others count up and
+    // are scheduled again once they reach the revolver cycles
+    if (thread->state() == Thread::RUNNABLE) {
+      fingerprint->push_back(thread->issue_cycle());
+    } else {
+      fingerprint->push_back(
+          std::min(thread->issue_cycle(), num_revolver_scheduling_cycles_));
+    }
+  }
+}
+
 bool RevolverScheduler::boot(ThreadID id) {
   Thread *thread = threads_[id];
   assert(thread->id() == id);
@@ -7,6 +7,7 @@
 #include "simulator/dpu/thread.h"
 #include "util/argument_parser.h"
 #include "util/stat_factory.h" 
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dpu {
 
@@ -17,6 +18,7 @@ class RevolverScheduler {
   ~RevolverScheduler();
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
   std::vector<Thread *> threads() { return threads_; }
 
   Thread *schedule();
@@ -31,6 +33,10 @@ class RevolverScheduler {
 
   int get_issuable_threads() { return issuable_threads_; };
 
+  // appends the round-robin position and each thread's state and issue cycle
+  void fingerprint(std::vector<int64_t> *fingerprint);
+  util::StatFactory *live_stat_factory() { return stat_factory_; }
+
  private:
   int num_revolver_scheduling_cycles_;
   int issuable_threads_;
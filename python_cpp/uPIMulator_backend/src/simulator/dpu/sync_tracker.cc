@@ -0,0 +1,151 @@
+#include "simulator/dpu/sync_tracker.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "util/config_loader.h"
+
+namespace upmem_sim::simulator::dpu {
+
+SyncTracker::SyncTracker()
+    : locks_(util::ConfigLoader::atomic_size()),
+      last_released_(util::ConfigLoader::max_num_tasklets(), -1),
+      release_next_pcs_(util::ConfigLoader::max_num_tasklets(), -1),
+      stopped_locks_(util::ConfigLoader::max_num_tasklets(), -1),
+      stop_cycles_(util::ConfigLoader::max_num_tasklets(), -1),
+      stat_factory_(new util::StatFactory("SyncTracker")) {}
+
+SyncTracker::~SyncTracker() { delete stat_factory_; }
+
+util::StatFactory *SyncTracker::stat_factory() {
+  update_stats();
+
+  auto stat_factory = new util::StatFactory("");
+  stat_factory->merge(stat_factory_);
+  return stat_factory;
+}
+
+util::StatTree *SyncTracker::stat_tree() {
+  update_stats();
+
+  return new util::StatTree(stat_factory_);
+}
+
+void SyncTracker::acquire(SimTime cycle, ThreadID thread_id, Address address,
+                          bool success) {
+  LockStats &lock = lock_stats(address);
+  SimTime &spin_begin_cycle = lock.spin_begin_cycles[thread_id];
+  last_released_[thread_id] = -1;
+
+  if (success) {
+    lock.num_acquires += 1;
+    lock.holder = thread_id;
+    lock.acquire_cycle = cycle;
+
+    if (spin_begin_cycle != -1) {
+      lock.spin_cycles += cycle - spin_begin_cycle;
+      lock.num_spinning_tasklets -= 1;
+      spin_begin_cycle = -1;
+    }
+  } else {
+    lock.num_failures += 1;
+
+    if (spin_begin_cycle == -1) {
+      spin_begin_cycle = cycle;
+      lock.num_spinning_tasklets += 1;
+      lock.max_spinning_tasklets =
+          std::max(lock.max_spinning_tasklets, lock.num_spinning_tasklets);
+    }
+  }
+}
+
+void SyncTracker::release(SimTime cycle, ThreadID thread_id, Address address,
+                          bool success, Address next_pc) {
+  LockStats &lock = lock_stats(address);
+
+  if (success and lock.holder == thread_id) {
+    lock.hold_cycles += cycle - lock.acquire_cycle;
+    lock.holder = -1;
+  }
+
+  last_released_[thread_id] = address;
+  release_next_pcs_[thread_id] = next_pc;
+}
+
+void SyncTracker::stop(SimTime cycle, ThreadID thread_id, Address pc) {
+  stop_cycles_[thread_id] = cycle;
+
+  // a release is charged at most once, and only to the stop right after it
+  if (last_released_[thread_id] != -1 and release_next_pcs_[thread_id] == pc) {
+    stopped_locks_[thread_id] = last_released_[thread_id];
+  } else {
+    stopped_locks_[thread_id] = -1;
+  }
+  last_released_[thread_id] = -1;
+}
+
+void SyncTracker::resume(SimTime cycle, ThreadID thread_id) {
+  if (stop_cycles_[thread_id] != -1 and stopped_locks_[thread_id] != -1) {
+    LockStats &lock = lock_stats(stopped_locks_[thread_id]);
+    lock.num_stops += 1;
+    lock.stop_cycles += cycle - stop_cycles_[thread_id];
+  }
+  stop_cycles_[thread_id] = -1;
+  stopped_locks_[thread_id] = -1;
+}
+
+void SyncTracker::fingerprint(std::vector<int64_t> *fingerprint) {
+  for (auto &lock : locks_) {
+    fingerprint->push_back(lock.holder);
+    fingerprint->push_back(lock.num_spinning_tasklets);
+  }
+}
+
+std::vector<int64_t> SyncTracker::num_failures() {
+  std::vector<int64_t> num_failures;
+  for (auto &lock : locks_) {
+    num_failures.push_back(lock.num_failures);
+  }
+  return num_failures;
+}
+
+void SyncTracker::add_failures(const std::vector<int64_t> &num_failures) {
+  assert(num_failures.size() == locks_.size());
+
+  for (int index = 0; index < static_cast<int>(locks_.size()); index++) {
+    locks_[index].num_failures += num_failures[index];
+  }
+}
+
+SyncTracker::LockStats &SyncTracker::lock_stats(Address address) {
+  Address index = address - util::ConfigLoader::atomic_offset();
+  assert(0 <= index and index < static_cast<Address>(locks_.size()));
+
+  LockStats &lock = locks_[index];
+  if (lock.spin_begin_cycles.empty()) {
+    lock.spin_begin_cycles.resize(util::ConfigLoader::max_num_tasklets(), -1);
+  }
+  return lock;
+}
+
+void SyncTracker::update_stats() {
+  // only bits that were ever touched are reported
+  for (int index = 0; index < static_cast<int>(locks_.size()); index++) {
+    LockStats &lock = locks_[index];
+    if (lock.spin_begin_cycles.empty()) {
+      continue;
+    }
+
+    std::string prefix = "lock" + std::to_string(index) + "_";
+    stat_factory_->overwrite(prefix + "acquires", lock.num_acquires);
+    stat_factory_->overwrite(prefix + "failures", lock.num_failures);
+    stat_factory_->overwrite(prefix + "hold_cycles", lock.hold_cycles);
+    stat_factory_->overwrite(prefix + "spin_cycles", lock.spin_cycles);
+    stat_factory_->overwrite(prefix + "max_spinning_tasklets",
+                             lock.max_spinning_tasklets);
+    stat_factory_->overwrite(prefix + "stops", lock.num_stops);
+    stat_factory_->overwrite(prefix + "stop_cycles", lock.stop_cycles);
+  }
+}
+
+}  // namespace upmem_sim::simulator::dpu
@@ -0,0 +1,73 @@
+#ifndef UPMEM_SIM_SIMULATOR_DPU_SYNC_TRACKER_H_
+#define UPMEM_SIM_SIMULATOR_DPU_SYNC_TRACKER_H_
+
+#include <vector>
+
+#include "main.h"
+#include "util/stat_factory.h"
+#include "util/stat_tree.h"
+
+namespace upmem_sim::simulator::dpu {
+
+// Contention per atomic bit: successful and failed (spinning) acquires, cycles
+// held, cycles tasklets spun before acquiring and the most tasklets spinning at
+// once. A tasklet whose stop is the very next instruction after releasing a
+// bit, as in barrier_wait and sem_take, has its stop-to-resume wait charged to
+// that bit; other stops are not charged to any bit.
+class SyncTracker {
+ public:
+  explicit SyncTracker();
+  ~SyncTracker();
+
+  util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
+
+  void acquire(SimTime cycle, ThreadID thread_id, Address address,
+               bool success);
+  // next_pc is where the releasing tasklet continues
+  void release(SimTime cycle, ThreadID thread_id, Address address, bool success,
+               Address next_pc);
+  void stop(SimTime cycle, ThreadID thread_id, Address pc);
+  void resume(SimTime cycle, ThreadID thread_id);
+
+  // appends the holder and spinning tasklets of each bit
+  void fingerprint(std::vector<int64_t> *fingerprint);
+  // failed acquires per bit
+  std::vector<int64_t> num_failures();
+  void add_failures(const std::vector<int64_t> &num_failures);
+
+ protected:
+  struct LockStats {
+    int64_t num_acquires = 0;
+    int64_t num_failures = 0;
+    int64_t hold_cycles = 0;
+    int64_t spin_cycles = 0;
+    int max_spinning_tasklets = 0;
+    int64_t num_stops = 0;
+    int64_t stop_cycles = 0;
+
+    ThreadID holder = -1;
+    SimTime acquire_cycle = 0;
+    // first failed acquire of each tasklet still spinning, -1 otherwise
+    std::vector<SimTime> spin_begin_cycles;
+    int num_spinning_tasklets = 0;
+  };
+
+  LockStats &lock_stats(Address address);
+  void update_stats();
+
+ private:
+  std::vector<LockStats> locks_;
+
+  // per tasklet; -1 when there is none
+  std::vector<Address> last_released_;
+  std::vector<Address> release_next_pcs_;
+  std::vector<Address> stopped_locks_;
+  std::vector<SimTime> stop_cycles_;
+
+  util::StatFactory *stat_factory_;
+};
+
+}  // namespace upmem_sim::simulator::dpu
+
+#endif
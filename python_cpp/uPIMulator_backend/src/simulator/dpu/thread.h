@@ -19,7 +19,8 @@ class Thread {
       : id_(id),
         state_(EMBRYO),
         reg_file_(new reg::RegFile(id_)),
-        issue_cycle_(0) {
+        issue_cycle_(0),
+        cycle_rule_cycles_(0) {
     assert(0 <= id and id < upmem_sim::util::ConfigLoader::max_num_tasklets());
     status_tracker_.emplace("WAIT_DATA", 0);
     status_tracker_.emplace("WAIT_SYNC", 0);
@@ -36,18 +37,24 @@ class Thread {
   int issue_cycle() { return issue_cycle_; }
   void increment_issue_cycle() { issue_cycle_ += 1; }
   void reset_issue_cycle() { issue_cycle_ = 0; }
+  void add_issue_cycles(int value) { issue_cycle_ += value; }
 
   void update_thread_status(ThreadStatus status, int64_t value) {
     status_tracker_[std::move(status)] += value;
   }
   std::map<ThreadStatus, int64_t> &status_tracker() { return status_tracker_; }
 
+  // kept apart from the status tracker, which feeds the latency breakdown
+  int64_t cycle_rule_cycles() { return cycle_rule_cycles_; }
+  void add_cycle_rule_cycles(int64_t value) { cycle_rule_cycles_ += value; }
+
  private:
   ThreadID id_;
   State state_;
   std::map<ThreadStatus, int64_t> status_tracker_;
   reg::RegFile *reg_file_;
   int issue_cycle_;
+  int64_t cycle_rule_cycles_;
 };
 
 }  // namespace upmem_sim::simulator::dpu
@@ -48,12 +48,14 @@ bool FRFCFSScheduler::service_fr() {
   if (row_address_ == nullptr) {
     return false;
   } else {
+    // decoding the DataAddressWord dominates the scan otherwise
+    Address row_address = row_address_->address();
     for (int i = 0; i < reorder_buffer_.size(); i++) {
       auto [dma_command, address, size] = reorder_buffer_[i];
 
       Address wordline_address = (address / wordline_size_) * wordline_size_;
 
-      if (row_address_->address() == wordline_address and
+      if (row_address == wordline_address and
           ready_q_->can_push(1)) {
         if (dma_command->operation() == dpu::DMACommand::READ) {
           ready_q_->push(new MemoryCommand(MemoryCommand::READ, address, size,
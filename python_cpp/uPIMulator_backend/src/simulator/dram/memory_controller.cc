@@ -9,6 +9,8 @@ MemoryController::MemoryController(util::ArgumentParser *argument_parser)
     : wordline_size_(argument_parser->get_int_parameter("wordline_size")),
       row_buffer_(new RowBuffer(argument_parser)),
       mram_(nullptr),
+      probe_(nullptr),
+      host_timer_(nullptr),
       input_q_(new basic::Queue<dpu::DMACommand>(-1)),
       wait_q_(new basic::Queue<dpu::DMACommand>(-1)),
       memory_command_q_(new basic::Queue<MemoryCommand>(1)),
@@ -52,6 +54,13 @@ util::StatFactory *MemoryController::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree *MemoryController::stat_tree() {
+  auto stat_tree = new util::StatTree(stat_factory_);
+  stat_tree->add_child(scheduler_->stat_tree());
+  stat_tree->add_child(row_buffer_->stat_tree());
+  return stat_tree;
+}
+
 void MemoryController::connect_mram(MRAM *mram) {
   assert(mram != nullptr);
   assert(mram_ == nullptr);
@@ -60,14 +69,37 @@ void MemoryController::connect_mram(MRAM *mram) {
   row_buffer_->connect_mram(mram);
 }
 
+void MemoryController::connect_probe(observer::Probe *probe) {
+  assert(probe != nullptr);
+  assert(probe_ == nullptr);
+
+  probe_ = probe;
+  row_buffer_->connect_probe(probe);
+}
+
+void MemoryController::connect_host_timer(
+    util::HostProfiler::Timer *host_timer) {
+  assert(host_timer != nullptr);
+  assert(host_timer_ == nullptr);
+
+  host_timer_ = host_timer;
+}
+
 void MemoryController::push(dpu::DMACommand *dma_command) {
   assert(dma_command != nullptr);
+  if (probe_ != nullptr) {
+    probe_push(dma_command);
+  }
   input_q_->push(dma_command);
 }
 
 dpu::DMACommand *MemoryController::pop() {
   assert(can_pop());
-  return ready_q_->pop();
+  dpu::DMACommand *dma_command = ready_q_->pop();
+  if (probe_ != nullptr) {
+    probe_pop(dma_command);
+  }
+  return dma_command;
 }
 
 dpu::DMACommand *MemoryController::front() {
@@ -161,6 +193,10 @@ void MemoryController::write(Address address, Address size,
 }
 
 void MemoryController::flush() {
+  if (probe_ != nullptr) {
+    probe_->memory_flush();
+  }
+
   scheduler_->flush();
   row_buffer_->flush();
 }
@@ -173,11 +209,24 @@ void MemoryController::cycle() {
   service_wait_q();
 
   scheduler_->cycle();
+  if (host_timer_ != nullptr) {
+    host_timer_->lap(util::HostProfiler::MEMORY_CONTROLLER);
+  }
+
   row_buffer_->cycle();
+  if (host_timer_ != nullptr) {
+    host_timer_->lap(util::HostProfiler::ROW_BUFFER);
+  }
 
   stat_factory_->increment("mem_cycle");
 }
 
+void MemoryController::idle(SimTime num_cycles) {
+  assert(empty());
+
+  stat_factory_->increment("mem_cycle", num_cycles);
+}
+
 void MemoryController::service_input_q() {
   if (input_q_->can_pop() and scheduler_->can_push() and wait_q_->can_push()) {
     dpu::DMACommand *dma_command = input_q_->pop();
@@ -235,4 +284,23 @@ void MemoryController::service_wait_q() {
   }
 }
 
+void MemoryController::probe_push(dpu::DMACommand *dma_command) {
+  // only the DMA engine pushes, always on behalf of an ldma or sdma
+  probe_->memory_push(dma_command->instruction()->thread()->id(),
+                      dma_command->operation() == dpu::DMACommand::READ
+                          ? observer::DMAEvent::READ
+                          : observer::DMAEvent::WRITE,
+                      dma_command->wram_address(),
+                      dma_command->mram_address(), dma_command->size());
+}
+
+void MemoryController::probe_pop(dpu::DMACommand *dma_command) {
+  probe_->memory_pop(dma_command->instruction()->thread()->id(),
+                     dma_command->operation() == dpu::DMACommand::READ
+                         ? observer::DMAEvent::READ
+                         : observer::DMAEvent::WRITE,
+                     dma_command->wram_address(), dma_command->mram_address(),
+                     dma_command->size());
+}
+
 }  // namespace upmem_sim::simulator::dram
@@ -4,6 +4,8 @@
 #include "simulator/dram/mram.h"
 #include "simulator/dram/row_buffer.h"
 #include "simulator/dram/scheduler.h"
+#include "util/host_profiler.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dram {
 
@@ -13,8 +15,11 @@ class MemoryController {
   ~MemoryController();
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
 
   void connect_mram(MRAM *mram);
+  void connect_probe(observer::Probe *probe);
+  void connect_host_timer(util::HostProfiler::Timer *host_timer);
 
   bool empty() {
     return input_q_->empty() and wait_q_->empty() and
@@ -36,6 +41,8 @@ class MemoryController {
   void flush();
 
   void cycle();
+  // num_cycles memory cycles of an empty controller, which only count
+  void idle(SimTime num_cycles);
 
  protected:
   void service_input_q();
@@ -44,12 +51,17 @@ class MemoryController {
   void service_row_buffer();
   void service_wait_q();
 
+  void probe_push(dpu::DMACommand *dma_command);
+  void probe_pop(dpu::DMACommand *dma_command);
+
  private:
   Address wordline_size_;
 
   Scheduler *scheduler_;
   RowBuffer *row_buffer_;
   MRAM *mram_;
+  observer::Probe *probe_;
+  util::HostProfiler::Timer *host_timer_;
 
   basic::Queue<dpu::DMACommand> *input_q_;
   basic::Queue<dpu::DMACommand> *wait_q_;
@@ -0,0 +1,238 @@
+#include "simulator/dram/memory_replay.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace upmem_sim::simulator::dram {
+
+MemoryReplay::MemoryReplay(util::ArgumentParser *argument_parser)
+    : argument_parser_(argument_parser),
+      page_pool_(new PagePool()),
+      memory_stat_factory_(new util::StatFactory("")),
+      stat_factory_(new util::StatFactory("MemoryReplay")) {
+  // MRAM contents do not affect timing; every replayed DPU shares one
+  mram_ = new MRAM(page_pool_, argument_parser);
+
+  load(argument_parser->get_string_parameter("memory_replay"));
+}
+
+MemoryReplay::~MemoryReplay() {
+  delete mram_;
+  delete page_pool_;
+
+  delete memory_stat_factory_;
+  delete stat_factory_;
+}
+
+util::StatFactory *MemoryReplay::stat_factory() {
+  auto stat_factory = new util::StatFactory("");
+
+  stat_factory->merge(stat_factory_);
+  stat_factory->merge(memory_stat_factory_);
+
+  return stat_factory;
+}
+
+void MemoryReplay::run() {
+  for (auto &stream : streams_) {
+    SimTime replay_cycle = replay(stream.second);
+    stat_factory_->overwrite(
+        "replay_cycle",
+        std::max(stat_factory_->value("replay_cycle"), replay_cycle));
+  }
+}
+
+void MemoryReplay::load(std::string filepath) {
+  gzFile file = gzopen(filepath.c_str(), "rb");
+  if (file == nullptr) {
+    throw std::invalid_argument("");
+  }
+
+  std::map<DPUID, std::map<ThreadID, SimTime>> pop_cycles;
+  std::map<DPUID, std::pair<int64_t, SimTime>> last_pops;
+
+  char line[128];
+  gzgets(file, line, sizeof(line));  // header
+  while (gzgets(file, line, sizeof(line)) != nullptr) {
+    std::stringstream ss(line);
+    std::vector<std::string> fields;
+    for (std::string field; std::getline(ss, field, ',');) {
+      fields.push_back(field);
+    }
+    if (fields.size() != 7) {
+      throw std::invalid_argument("");
+    }
+
+    SimTime cycle = std::stoll(fields[0]);
+    DPUID dpu_id = std::stoi(fields[1]);
+    Stream &stream = streams_[dpu_id];
+    auto &[num_pops, last_pop_cycle] = last_pops[dpu_id];
+    if (fields[2] == "flush") {
+      stream.flushes.emplace_back(num_pops, cycle - last_pop_cycle);
+      continue;
+    } else if (fields[2] == "end") {
+      stream.tail = cycle - last_pop_cycle;
+      continue;
+    }
+
+    ThreadID thread_id = std::stoi(fields[3]);
+    if (fields[2] == "push") {
+      Command command{cycle - pop_cycles[dpu_id][thread_id],
+                      fields[4] == "read" ? dpu::DMACommand::READ
+                                          : dpu::DMACommand::WRITE,
+                      std::stoll(fields[5]), std::stoll(fields[6])};
+      stream.commands[thread_id].push_back(command);
+    } else if (fields[2] == "pop") {
+      pop_cycles[dpu_id][thread_id] = cycle;
+      num_pops++;
+      last_pop_cycle = cycle;
+    } else {
+      throw std::invalid_argument("");
+    }
+  }
+
+  gzclose(file);
+}
+
+SimTime MemoryReplay::replay(Stream &stream) {
+  auto memory_controller = new MemoryController(argument_parser_);
+  memory_controller->connect_mram(mram_);
+  // same stepping as DPU::cycle
+  basic::ClockDomain memory_clock(
+      argument_parser_->get_int_parameter("memory_frequency"),
+      argument_parser_->get_int_parameter("logic_frequency"));
+
+  // (cycle, order, thread) of the next command of each tasklet
+  using Due = std::tuple<SimTime, int64_t, ThreadID>;
+  std::priority_queue<Due, std::vector<Due>, std::greater<>> due_q;
+  std::priority_queue<SimTime, std::vector<SimTime>, std::greater<>>
+      flush_q;
+  std::deque<ThreadID> ready_q;
+  std::map<ThreadID, int> next;
+  std::unordered_map<dpu::DMACommand *, ThreadID> in_flight;
+  int64_t order = 0;
+  int64_t num_pops = 0;
+  SimTime last_pop_cycle = 0;
+  int flush_index = 0;
+
+  auto schedule_flushes = [&](SimTime cycle) {
+    while (flush_index < stream.flushes.size() and
+           stream.flushes[flush_index].first == num_pops) {
+      flush_q.push(cycle + stream.flushes[flush_index].second);
+      flush_index++;
+    }
+  };
+
+  for (auto &[thread_id, commands] : stream.commands) {
+    next[thread_id] = 0;
+    due_q.emplace(commands[0].delay, order++, thread_id);
+  }
+  schedule_flushes(0);
+
+  SimTime cycle = 0;
+  while (not due_q.empty() or not ready_q.empty() or
+         not memory_controller->empty() or not flush_q.empty() or
+         flush_index < stream.flushes.size()) {
+    // nothing in flight: jump to the next due command or flush
+    if (ready_q.empty() and memory_controller->empty() and
+        (not due_q.empty() or not flush_q.empty())) {
+      SimTime next_cycle = std::numeric_limits<SimTime>::max();
+      if (not due_q.empty()) {
+        next_cycle = std::get<0>(due_q.top());
+      }
+      if (not flush_q.empty()) {
+        next_cycle = std::min(next_cycle, flush_q.top());
+      }
+      if (next_cycle > cycle) {
+        memory_controller->idle(memory_clock.tick(next_cycle - cycle));
+        cycle = next_cycle;
+      }
+    }
+
+    while (not due_q.empty() and std::get<0>(due_q.top()) <= cycle) {
+      ready_q.push_back(std::get<2>(due_q.top()));
+      due_q.pop();
+    }
+
+    // the DMA engine moves one command per logic cycle each way
+    if (not ready_q.empty() and memory_controller->can_push()) {
+      ThreadID thread_id = ready_q.front();
+      ready_q.pop_front();
+
+      Command &command = stream.commands[thread_id][next[thread_id]];
+      dpu::DMACommand *dma_command;
+      if (command.operation == dpu::DMACommand::READ) {
+        dma_command = new dpu::DMACommand(
+            dpu::DMACommand::READ, command.mram_address, command.size);
+      } else {
+        dma_command = new dpu::DMACommand(
+            dpu::DMACommand::WRITE, command.mram_address, command.size,
+            std::vector<int>(command.size, 0));
+      }
+      in_flight[dma_command] = thread_id;
+      memory_controller->push(dma_command);
+
+      stat_factory_->increment("num_commands");
+    }
+
+    if (memory_controller->can_pop()) {
+      dpu::DMACommand *dma_command = memory_controller->pop();
+      ThreadID thread_id = in_flight[dma_command];
+      in_flight.erase(dma_command);
+      delete dma_command;
+
+      std::vector<Command> &commands = stream.commands[thread_id];
+      if (++next[thread_id] < commands.size()) {
+        due_q.emplace(cycle + commands[next[thread_id]].delay, order++,
+                      thread_id);
+      }
+
+      num_pops++;
+      last_pop_cycle = cycle;
+      schedule_flushes(cycle);
+    }
+
+    for (int i = memory_clock.tick(); i > 0; i--) {
+      memory_controller->cycle();
+    }
+
+    // host accesses land between logic cycles
+    while (not flush_q.empty() and flush_q.top() <= cycle) {
+      memory_controller->flush();
+      flush_q.pop();
+
+      stat_factory_->increment("num_flushes");
+    }
+
+    cycle++;
+  }
+
+  if (last_pop_cycle + stream.tail > cycle) {
+    memory_controller->idle(
+        memory_clock.tick(last_pop_cycle + stream.tail - cycle));
+    cycle = last_pop_cycle + stream.tail;
+  }
+
+  // the same key nesting as System, Rank and DPU in a full run
+  auto dpu_stat_factory = new util::StatFactory("");
+  util::StatFactory *memory_stat_factory = memory_controller->stat_factory();
+  dpu_stat_factory->merge(memory_stat_factory);
+  memory_stat_factory_->merge(dpu_stat_factory);
+  delete memory_stat_factory;
+  delete dpu_stat_factory;
+
+  delete memory_controller;
+
+  return cycle;
+}
+
+}  // namespace upmem_sim::simulator::dram
@@ -0,0 +1,70 @@
+#ifndef UPMEM_SIM_SIMULATOR_DRAM_MEMORY_REPLAY_H_
+#define UPMEM_SIM_SIMULATOR_DRAM_MEMORY_REPLAY_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "simulator/basic/clock_domain.h"
+#include "simulator/dram/memory_controller.h"
+#include "simulator/dram/mram.h"
+#include "simulator/dram/page_pool.h"
+#include "util/argument_parser.h"
+#include "util/stat_factory.h"
+
+namespace upmem_sim::simulator::dram {
+
+// Drives one MemoryController per DPU from a memory_trace, without the
+// pipeline, under the timing and scheduling options of this run. The replay
+// is closed-loop: a tasklet's next DMACommand is pushed as many logic cycles
+// after its previous one pops as in the recording, so a slower memory policy
+// also delays the requests that depended on it, and the DPU runs as many logic
+// cycles past its last pop as recorded. With the recorded options every
+// MemoryController stat of the full simulation, mem_cycle included, is
+// reproduced except the per-tasklet row_buffer/<thread>_* ones, which need the
+// instruction a replayed DMACommand does not carry.
+class MemoryReplay {
+ public:
+  explicit MemoryReplay(util::ArgumentParser *argument_parser);
+  ~MemoryReplay();
+
+  util::StatFactory *stat_factory();
+
+  void run();
+
+ protected:
+  struct Command {
+    // logic cycles since the tasklet's previous command popped, or since the
+    // first cycle
+    SimTime delay;
+    dpu::DMACommand::Operation operation;
+    Address mram_address;
+    Address size;
+  };
+
+  struct Stream {
+    std::map<ThreadID, std::vector<Command>> commands;
+    // pairs of (pops before the flush, logic cycles since the last of them)
+    std::vector<std::pair<int64_t, SimTime>> flushes;
+    // logic cycles from the last pop to the end of the DPU
+    SimTime tail = 0;
+  };
+
+  void load(std::string filepath);
+  SimTime replay(Stream &stream);
+
+ private:
+  util::ArgumentParser *argument_parser_;
+
+  PagePool *page_pool_;
+  MRAM *mram_;
+  std::map<DPUID, Stream> streams_;
+
+  util::StatFactory *memory_stat_factory_;
+  util::StatFactory *stat_factory_;
+};
+
+}  // namespace upmem_sim::simulator::dram
+
+#endif
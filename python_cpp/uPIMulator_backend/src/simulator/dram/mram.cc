@@ -2,7 +2,7 @@
 
 namespace upmem_sim::simulator::dram {
 
-MRAM::MRAM(util::ArgumentParser *argument_parser)
+MRAM::MRAM(PagePool *page_pool, util::ArgumentParser *argument_parser)
     : address_(new abi::word::DataAddressWord()),
       size_(util::ConfigLoader::mram_size()) {
   address_->set_value(util::ConfigLoader::mram_offset());
@@ -19,8 +19,8 @@ MRAM::MRAM(util::ArgumentParser *argument_parser)
 
   wordlines_.resize(num_wordlines_);
   for (int i = 0; i < num_wordlines_; i++) {
-    wordlines_[i] =
-        new Wordline(argument_parser, address() + i * wordline_size_);
+    wordlines_[i] = new Wordline(argument_parser,
+                                 address() + i * wordline_size_, page_pool);
   }
 }
 
@@ -44,9 +44,16 @@ void MRAM::write(Address address, encoder::ByteStream *byte_stream) {
   wordlines_[index(address)]->write(byte_stream);
 }
 
+void MRAM::share() {
+  for (auto &wordline : wordlines_) {
+    wordline->share();
+  }
+}
+
 int MRAM::index(Address address) {
   assert(address >= this->address());
-  assert(address + abi::word::DataWord().size() <= this->address() + size_);
+  assert(address + util::ConfigLoader::mram_data_width() / 8 <=
+         this->address() + size_);
   assert(address % wordline_size_ == 0);
 
   return static_cast<int>((address - this->address()) / wordline_size_);
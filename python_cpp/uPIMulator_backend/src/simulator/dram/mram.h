@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "abi/word/data_address_word.h"
+#include "simulator/dram/page_pool.h"
 #include "simulator/dram/wordline.h"
 #include "util/argument_parser.h"
 
@@ -11,7 +12,7 @@ namespace upmem_sim::simulator::dram {
 
 class MRAM {
  public:
-  explicit MRAM(util::ArgumentParser *argument_parser);
+  explicit MRAM(PagePool *page_pool, util::ArgumentParser *argument_parser);
   ~MRAM();
 
   Address address() { return address_->address(); }
@@ -22,6 +23,9 @@ class MRAM {
   void write(Address address, std::vector<int> bytes);
   void write(Address address, encoder::ByteStream *byte_stream);
 
+  // returns the wordlines written in place since the last call to the pool
+  void share();
+
   void cycle() = delete;
 
  protected:
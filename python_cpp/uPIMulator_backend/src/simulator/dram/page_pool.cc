@@ -0,0 +1,67 @@
+#include "simulator/dram/page_pool.h"
+
+namespace upmem_sim::simulator::dram {
+
+PagePool::Page PagePool::intern(Bytes bytes) {
+  uint64_t key = hash(bytes);
+  Shard &shard = this->shard(key);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  num_interns_++;
+
+  auto &bucket = shard.pages[key];
+  for (auto &entry : bucket) {
+    // an expired entry is being released and is skipped
+    if (Page page = entry.second.lock(); page != nullptr and *page == bytes) {
+      return page;
+    }
+  }
+
+  auto owned = new Bytes(std::move(bytes));
+  Page page(owned, [this, key](const Bytes *bytes) { release(key, bytes); });
+  bucket.emplace_back(owned, page);
+  return page;
+}
+
+int64_t PagePool::num_pages() {
+  int64_t num_pages = num_private_pages_;
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    for (auto &bucket : shard.pages) {
+      num_pages += static_cast<int64_t>(bucket.second.size());
+    }
+  }
+  return num_pages;
+}
+
+uint64_t PagePool::hash(const Bytes &bytes) {
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto &byte : bytes) {
+    hash = (hash ^ byte) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+void PagePool::release(uint64_t key, const Bytes *bytes) {
+  {
+    Shard &shard = this->shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto &bucket = shard.pages[key];
+    for (auto it = bucket.begin(); it != bucket.end(); it++) {
+      if (it->first == bytes) {
+        bucket.erase(it);
+        break;
+      }
+    }
+    if (bucket.empty()) {
+      shard.pages.erase(key);
+    }
+  }
+
+  delete bytes;
+}
+
+}  // namespace upmem_sim::simulator::dram
@@ -0,0 +1,66 @@
+#ifndef UPMEM_SIM_SIMULATOR_DRAM_PAGE_POOL_H_
+#define UPMEM_SIM_SIMULATOR_DRAM_PAGE_POOL_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "main.h"
+
+namespace upmem_sim::simulator::dram {
+
+// Content-addressed store of MRAM wordline images shared by every MRAM in the
+// system; only wordline bytes are deduplicated, not the rest of a DPU's state.
+// Pages are immutable: DPUs that were written the same bytes hold one copy,
+// and a write interns a new image. A wordline whose page nobody else holds
+// is written in place outside the pool and rejoins it at the next launch.
+// A page leaves the pool with its last holder.
+// The pool is split into shards by hash so that ranks stepped on different
+// host threads rarely contend on one lock.
+class PagePool {
+ public:
+  using Bytes = std::vector<uint8_t>;
+  using Page = std::shared_ptr<const Bytes>;
+
+  PagePool() = default;
+  ~PagePool() = default;
+
+  Page intern(Bytes bytes);
+
+  // wordlines written in place keep their bytes outside the pool and only
+  // report them here
+  void add_private_page() { num_private_pages_++; }
+  void remove_private_page() { num_private_pages_--; }
+
+  int64_t num_pages();
+  int64_t num_interns() { return num_interns_; }
+
+ protected:
+  // the raw pointer identifies the entry once the weak_ptr has expired
+  using Entry = std::pair<const Bytes *, std::weak_ptr<const Bytes>>;
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<uint64_t, std::vector<Entry>> pages;
+  };
+
+  static uint64_t hash(const Bytes &bytes);
+
+  Shard &shard(uint64_t key) { return shards_[key % shards_.size()]; }
+
+  void release(uint64_t key, const Bytes *bytes);
+
+ private:
+  std::array<Shard, 64> shards_;
+  std::atomic<int64_t> num_private_pages_ = 0;
+  std::atomic<int64_t> num_interns_ = 0;
+};
+
+}  // namespace upmem_sim::simulator::dram
+
+#endif
@@ -4,6 +4,7 @@ namespace upmem_sim::simulator::dram {
 
 RowBuffer::RowBuffer(util::ArgumentParser *argument_parser)
     : mram_(nullptr),
+      probe_(nullptr),
       row_address_(nullptr),
       input_q_(new basic::Queue<MemoryCommand>(1)),
       ready_q_(new basic::Queue<MemoryCommand>(-1)),
@@ -57,6 +58,10 @@ util::StatFactory *RowBuffer::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree *RowBuffer::stat_tree() {
+  return new util::StatTree(stat_factory_);
+}
+
 void RowBuffer::connect_mram(MRAM *mram) {
   assert(mram != nullptr);
   assert(mram_ == nullptr);
@@ -64,6 +69,13 @@ void RowBuffer::connect_mram(MRAM *mram) {
   mram_ = mram;
 }
 
+void RowBuffer::connect_probe(observer::Probe *probe) {
+  assert(probe != nullptr);
+  assert(probe_ == nullptr);
+
+  probe_ = probe;
+}
+
 void RowBuffer::push(MemoryCommand *memory_command) {
   assert(memory_command != nullptr);
   assert(can_push());
@@ -137,6 +149,10 @@ void RowBuffer::service_activation_q() {
     row_address_->set_value(memory_command->address());
 
     row_buffer_ = read_from_mram();
+
+    if (probe_ != nullptr) {
+      probe_->row_activate(row_address_->address());
+    }
   }
 
   if (activation_q_->can_pop() and ready_q_->can_push()) {
@@ -213,6 +229,10 @@ void RowBuffer::service_precharge_q() {
     assert(memory_command->address() % wordline_size_ == 0);
     assert(memory_command->address() == row_address_->address());
 
+    if (probe_ != nullptr) {
+      probe_->row_precharge(row_address_->address());
+    }
+
     write_to_mram();
     delete row_address_;
     row_address_ = nullptr;
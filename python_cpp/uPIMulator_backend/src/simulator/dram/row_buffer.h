@@ -8,8 +8,10 @@
 #include "simulator/basic/timer_queue.h"
 #include "simulator/dram/memory_command.h"
 #include "simulator/dram/mram.h"
+#include "simulator/observer/probe.h"
 #include "util/argument_parser.h"
 #include "util/stat_factory.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dram {
 
@@ -19,8 +21,10 @@ class RowBuffer {
   ~RowBuffer();
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
 
   void connect_mram(MRAM *mram);
+  void connect_probe(observer::Probe *probe);
 
   bool empty() {
     return input_q_->empty() and ready_q_->empty() and
@@ -58,6 +62,7 @@ class RowBuffer {
   Address wordline_size_;
 
   MRAM *mram_;
+  observer::Probe *probe_;
   abi::word::DataAddressWord *row_address_;
   std::vector<int> row_buffer_;
 
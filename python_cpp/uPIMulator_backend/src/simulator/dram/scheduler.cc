@@ -29,6 +29,10 @@ util::StatFactory *Scheduler::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree *Scheduler::stat_tree() {
+  return new util::StatTree(stat_factory_);
+}
+
 void Scheduler::push(dpu::DMACommand *dma_command) {
   assert(dma_command != nullptr);
   input_q_->push(dma_command);
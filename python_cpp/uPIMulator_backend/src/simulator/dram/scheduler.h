@@ -6,6 +6,7 @@
 #include "simulator/dram/memory_command.h"
 #include "util/argument_parser.h"
 #include "util/stat_factory.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::dram {
 
@@ -17,6 +18,7 @@ class Scheduler {
   ~Scheduler();
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
 
   bool empty() {
     return input_q_->empty() and ready_q_->empty() and reorder_buffer_.empty();
@@ -1,70 +1,80 @@
 #include "simulator/dram/wordline.h"
 
+#include <algorithm>
+
 namespace upmem_sim::simulator::dram {
 
-Wordline::Wordline(util::ArgumentParser *argument_parser, Address address)
+Wordline::Wordline(util::ArgumentParser *argument_parser, Address address,
+                   PagePool *page_pool)
     : address_(new abi::word::DataAddressWord()),
-      size_(argument_parser->get_int_parameter("wordline_size")) {
+      size_(argument_parser->get_int_parameter("wordline_size")),
+      page_pool_(page_pool) {
   assert(address >= util::ConfigLoader::mram_offset());
   assert(address + size_ <=
          util::ConfigLoader::mram_offset() + util::ConfigLoader::mram_size());
   assert(address % size_ == 0);
   assert(size_ % util::ConfigLoader::min_access_granularity() == 0);
-  assert(size_ % abi::word::DataWord().size() == 0);
+  assert(size_ % (util::ConfigLoader::mram_data_width() / 8) == 0);
+  assert(page_pool != nullptr);
 
   address_->set_value(address);
-
-  data_words_.resize(num_data_words());
-  for (int i = 0; i < num_data_words(); i++) {
-    data_words_[i] = new abi::word::DataWord();
-  }
 }
 
 Wordline::~Wordline() {
   delete address_;
 
-  for (int i = 0; i < num_data_words(); i++) {
-    delete data_words_[i];
+  if (private_page_ != nullptr) {
+    page_pool_->remove_private_page();
   }
 }
 
 std::vector<int> Wordline::read() {
-  auto byte_stream = new encoder::ByteStream();
-
-  for (int i = 0; i < num_data_words(); i++) {
-    auto data_word_byte_stream = data_words_[i]->to_byte_stream();
-    byte_stream->merge(data_word_byte_stream);
-    delete data_word_byte_stream;
+  if (private_page_ != nullptr) {
+    return std::vector<int>(private_page_->begin(), private_page_->end());
+  } else if (page_ == nullptr) {
+    return std::vector<int>(size_, 0);
   }
-
-  std::vector<int> bytes = byte_stream->bytes();
-
-  delete byte_stream;
-
-  return std::move(bytes);
+  return std::vector<int>(page_->begin(), page_->end());
 }
 
 void Wordline::write(std::vector<int> bytes) {
   assert(bytes.size() == size_);
 
-  Address data_word_size = abi::word::DataWord().size();
-  for (int i = 0; i < num_data_words(); i++) {
-    for (int j = 0; j < data_word_size; j++) {
-      int index = static_cast<int>(i * data_word_size + j);
+  if (private_page_ != nullptr) {
+    std::copy(bytes.begin(), bytes.end(), private_page_->begin());
+    return;
+  }
+
+  PagePool::Bytes page(bytes.begin(), bytes.end());
+  if (page_ != nullptr and *page_ == page) {
+    return;
+  }
 
-      data_words_[i]->set_bit_slice(8 * j, 8 * (j + 1), bytes[index]);
-    }
+  if (page_ != nullptr and page_.use_count() == 1) {
+    // the old image was not shared, so the new one is unlikely to be either;
+    // skip hashing it and every later write to this wordline
+    page_ = nullptr;
+    private_page_ = std::make_unique<PagePool::Bytes>(std::move(page));
+    page_pool_->add_private_page();
+  } else {
+    page_ = page_pool_->intern(std::move(page));
   }
 }
 
 void Wordline::write(encoder::ByteStream *byte_stream) {
   assert(byte_stream->size() == size_);
 
-  for (int i = 0; i < num_data_words(); i++) {
-    encoder::ByteStream *slice = byte_stream->slice(8 * i, 8 * (i + 1));
-    data_words_[i]->from_byte_stream(slice);
-    delete slice;
+  write(byte_stream->bytes());
+}
+
+void Wordline::share() {
+  if (private_page_ == nullptr) {
+    return;
   }
+
+  page_ = page_pool_->intern(std::move(*private_page_));
+  private_page_ = nullptr;
+  page_pool_->remove_private_page();
 }
 
 }  // namespace upmem_sim::simulator::dram
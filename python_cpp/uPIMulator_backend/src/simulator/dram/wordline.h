@@ -1,17 +1,20 @@
 #ifndef UPMEM_SIM_SIMULATOR_DRAM_WORDLINE_H_
 #define UPMEM_SIM_SIMULATOR_DRAM_WORDLINE_H_
 
+#include <memory>
 #include <vector>
 
 #include "abi/word/data_address_word.h"
 #include "abi/word/data_word.h"
+#include "simulator/dram/page_pool.h"
 #include "util/argument_parser.h"
 
 namespace upmem_sim::simulator::dram {
 
 class Wordline {
  public:
-  explicit Wordline(util::ArgumentParser *argument_parser, Address address);
+  explicit Wordline(util::ArgumentParser *argument_parser, Address address,
+                    PagePool *page_pool);
   ~Wordline();
 
   Address address() { return address_->address(); }
@@ -22,17 +25,21 @@ class Wordline {
   void write(std::vector<int> bytes);
   void write(encoder::ByteStream *byte_stream);
 
-  void cycle() = delete;
+  // moves a private page back into the pool
+  void share();
 
- protected:
-  int num_data_words() {
-    return static_cast<int>(size_ / abi::word::DataWord().size());
-  }
+  void cycle() = delete;
 
  private:
   abi::word::DataAddressWord *address_;
   Address size_;
-  std::vector<abi::word::DataWord *> data_words_;
+
+  // nullptr until the first write; reads as zeros
+  PagePool *page_pool_;
+  PagePool::Page page_;
+  // nullptr while the wordline goes through the pool; once its page is held
+  // by no one else the bytes move here and are written in place until share()
+  std::unique_ptr<PagePool::Bytes> private_page_;
 };
 
 }  // namespace upmem_sim::simulator::dram
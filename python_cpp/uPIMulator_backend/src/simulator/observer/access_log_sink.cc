@@ -0,0 +1,53 @@
+#include "simulator/observer/access_log_sink.h"
+
+namespace upmem_sim::simulator::observer {
+
+AccessLogSink::AccessLogSink(std::string filepath)
+    : GzCSVSink(filepath,
+                "cycle,dpu_id,event,thread_id,address,size,mram_address") {}
+
+void AccessLogSink::on_dma_issue(const DMAEvent &event) {
+  write("%ld,%d,%s,%d,%ld,%ld,%ld\n", event.cycle, event.dpu_id,
+        event.operation == DMAEvent::READ ? "ldma" : "sdma", event.thread_id,
+        event.wram_address, event.size, event.mram_address);
+}
+
+void AccessLogSink::on_dma_complete(const DMAEvent &event) {
+  write("%ld,%d,%s,%d,%ld,%ld,%ld\n", event.cycle, event.dpu_id,
+        event.operation == DMAEvent::READ ? "ldma_done" : "sdma_done",
+        event.thread_id, event.wram_address, event.size, event.mram_address);
+}
+
+void AccessLogSink::on_row_activate(const RowEvent &event) {
+  write("%ld,%d,activate,,%ld,,\n", event.cycle, event.dpu_id,
+        event.row_address);
+}
+
+void AccessLogSink::on_row_precharge(const RowEvent &event) {
+  write("%ld,%d,precharge,,%ld,,\n", event.cycle, event.dpu_id,
+        event.row_address);
+}
+
+void AccessLogSink::on_wram_load(const WRAMEvent &event) {
+  write("%ld,%d,load,%d,%ld,%ld,\n", event.cycle, event.dpu_id,
+        event.thread_id, event.address, event.size);
+}
+
+void AccessLogSink::on_wram_store(const WRAMEvent &event) {
+  write("%ld,%d,store,%d,%ld,%ld,\n", event.cycle, event.dpu_id,
+        event.thread_id, event.address, event.size);
+}
+
+void AccessLogSink::on_lock_acquire(const LockEvent &event) {
+  write("%ld,%d,%s,%d,%ld,,\n", event.cycle, event.dpu_id,
+        event.success ? "acquire" : "acquire_fail", event.thread_id,
+        event.lock_address);
+}
+
+void AccessLogSink::on_lock_release(const LockEvent &event) {
+  write("%ld,%d,%s,%d,%ld,,\n", event.cycle, event.dpu_id,
+        event.success ? "release" : "release_fail", event.thread_id,
+        event.lock_address);
+}
+
+}  // namespace upmem_sim::simulator::observer
@@ -0,0 +1,32 @@
+#ifndef UPMEM_SIM_SIMULATOR_OBSERVER_ACCESS_LOG_SINK_H_
+#define UPMEM_SIM_SIMULATOR_OBSERVER_ACCESS_LOG_SINK_H_
+
+#include <string>
+
+#include "simulator/observer/gz_csv_sink.h"
+
+namespace upmem_sim::simulator::observer {
+
+// gzip-compressed CSV, one line per event:
+// cycle,dpu_id,event,thread_id,address,size,mram_address
+class AccessLogSink : public GzCSVSink {
+ public:
+  explicit AccessLogSink(std::string filepath);
+  ~AccessLogSink() = default;
+
+  void on_dma_issue(const DMAEvent &event) override;
+  void on_dma_complete(const DMAEvent &event) override;
+
+  void on_row_activate(const RowEvent &event) override;
+  void on_row_precharge(const RowEvent &event) override;
+
+  void on_wram_load(const WRAMEvent &event) override;
+  void on_wram_store(const WRAMEvent &event) override;
+
+  void on_lock_acquire(const LockEvent &event) override;
+  void on_lock_release(const LockEvent &event) override;
+};
+
+}  // namespace upmem_sim::simulator::observer
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef UPMEM_SIM_SIMULATOR_OBSERVER_ACCESS_OBSERVER_H_
+#define UPMEM_SIM_SIMULATOR_OBSERVER_ACCESS_OBSERVER_H_
+
+#include "main.h"
+
+namespace upmem_sim::simulator::observer {
+
+// all cycles are logic cycles of the DPU raising the event
+
+struct DMAEvent {
+  // READ moves MRAM to WRAM (ldma), WRITE moves WRAM to MRAM (sdma)
+  enum Operation { READ = 0, WRITE };
+
+  DPUID dpu_id;
+  SimTime cycle;
+  ThreadID thread_id;
+  Operation operation;
+  Address wram_address;
+  Address mram_address;
+  Address size;
+};
+
+struct RowEvent {
+  DPUID dpu_id;
+  SimTime cycle;
+  Address row_address;
+};
+
+struct WRAMEvent {
+  DPUID dpu_id;
+  SimTime cycle;
+  ThreadID thread_id;
+  Address address;
+  Address size;
+};
+
+struct FlushEvent {
+  DPUID dpu_id;
+  SimTime cycle;
+};
+
+struct LockEvent {
+  DPUID dpu_id;
+  SimTime cycle;
+  ThreadID thread_id;
+  Address lock_address;
+  bool success;
+};
+
+class AccessObserver {
+ public:
+  virtual ~AccessObserver() = default;
+
+  virtual void on_dma_issue(const DMAEvent &event) {}
+  virtual void on_dma_complete(const DMAEvent &event) {}
+
+  // a DMACommand entering and leaving the memory controller; a flush is a
+  // host MRAM access closing the open row between launches
+  virtual void on_memory_push(const DMAEvent &event) {}
+  virtual void on_memory_pop(const DMAEvent &event) {}
+  virtual void on_memory_flush(const FlushEvent &event) {}
+
+  virtual void on_row_activate(const RowEvent &event) {}
+  virtual void on_row_precharge(const RowEvent &event) {}
+
+  virtual void on_wram_load(const WRAMEvent &event) {}
+  virtual void on_wram_store(const WRAMEvent &event) {}
+
+  virtual void on_lock_acquire(const LockEvent &event) {}
+  virtual void on_lock_release(const LockEvent &event) {}
+};
+
+}  // namespace upmem_sim::simulator::observer
+
+#endif
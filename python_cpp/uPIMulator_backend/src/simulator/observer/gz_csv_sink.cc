@@ -0,0 +1,30 @@
+#include "simulator/observer/gz_csv_sink.h"
+
+#include <cstdarg>
+#include <stdexcept>
+
+namespace upmem_sim::simulator::observer {
+
+GzCSVSink::GzCSVSink(std::string filepath, std::string header) {
+  file_ = gzopen(filepath.c_str(), "wb");
+  if (file_ == nullptr) {
+    throw std::invalid_argument("");
+  }
+  gzputs(file_, (header + "\n").c_str());
+}
+
+GzCSVSink::~GzCSVSink() { gzclose(file_); }
+
+void GzCSVSink::write(const char *format, ...) {
+  char line[128];
+
+  va_list args;
+  va_start(args, format);
+  vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  gzputs(file_, line);
+}
+
+}  // namespace upmem_sim::simulator::observer
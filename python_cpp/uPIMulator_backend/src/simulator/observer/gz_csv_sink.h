@@ -0,0 +1,30 @@
+#ifndef UPMEM_SIM_SIMULATOR_OBSERVER_GZ_CSV_SINK_H_
+#define UPMEM_SIM_SIMULATOR_OBSERVER_GZ_CSV_SINK_H_
+
+#include <zlib.h>
+
+#include <mutex>
+#include <string>
+
+#include "simulator/observer/access_observer.h"
+
+namespace upmem_sim::simulator::observer {
+
+// Observer writing one gzip-compressed CSV; DPUs on different host threads
+// may write concurrently.
+class GzCSVSink : public AccessObserver {
+ public:
+  explicit GzCSVSink(std::string filepath, std::string header);
+  ~GzCSVSink();
+
+ protected:
+  void write(const char *format, ...);
+
+ private:
+  gzFile file_;
+  std::mutex mutex_;
+};
+
+}  // namespace upmem_sim::simulator::observer
+
+#endif
@@ -0,0 +1,29 @@
+#include "simulator/observer/memory_trace_sink.h"
+
+namespace upmem_sim::simulator::observer {
+
+MemoryTraceSink::MemoryTraceSink(std::string filepath)
+    : GzCSVSink(filepath,
+                "cycle,dpu_id,event,thread_id,operation,mram_address,size") {}
+
+void MemoryTraceSink::end(DPUID dpu_id, SimTime num_cycles) {
+  write("%ld,%d,end,,,,\n", num_cycles, dpu_id);
+}
+
+void MemoryTraceSink::on_memory_push(const DMAEvent &event) {
+  write("%ld,%d,push,%d,%s,%ld,%ld\n", event.cycle, event.dpu_id,
+        event.thread_id, event.operation == DMAEvent::READ ? "read" : "write",
+        event.mram_address, event.size);
+}
+
+void MemoryTraceSink::on_memory_pop(const DMAEvent &event) {
+  write("%ld,%d,pop,%d,%s,%ld,%ld\n", event.cycle, event.dpu_id,
+        event.thread_id, event.operation == DMAEvent::READ ? "read" : "write",
+        event.mram_address, event.size);
+}
+
+void MemoryTraceSink::on_memory_flush(const FlushEvent &event) {
+  write("%ld,%d,flush,,,,\n", event.cycle, event.dpu_id);
+}
+
+}  // namespace upmem_sim::simulator::observer
@@ -0,0 +1,28 @@
+#ifndef UPMEM_SIM_SIMULATOR_OBSERVER_MEMORY_TRACE_SINK_H_
+#define UPMEM_SIM_SIMULATOR_OBSERVER_MEMORY_TRACE_SINK_H_
+
+#include <string>
+
+#include "simulator/observer/gz_csv_sink.h"
+
+namespace upmem_sim::simulator::observer {
+
+// gzip-compressed CSV of the memory controller boundary, read back by
+// dram::MemoryReplay, one line per event:
+// cycle,dpu_id,event,thread_id,operation,mram_address,size
+// and a last end line per DPU carrying its number of logic cycles
+class MemoryTraceSink : public GzCSVSink {
+ public:
+  explicit MemoryTraceSink(std::string filepath);
+  ~MemoryTraceSink() = default;
+
+  void end(DPUID dpu_id, SimTime num_cycles);
+
+  void on_memory_push(const DMAEvent &event) override;
+  void on_memory_pop(const DMAEvent &event) override;
+  void on_memory_flush(const FlushEvent &event) override;
+};
+
+}  // namespace upmem_sim::simulator::observer
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef UPMEM_SIM_SIMULATOR_OBSERVER_PROBE_H_
+#define UPMEM_SIM_SIMULATOR_OBSERVER_PROBE_H_
+
+#include <vector>
+
+#include "simulator/observer/access_observer.h"
+
+namespace upmem_sim::simulator::observer {
+
+// Per-DPU event source. Components hold a Probe pointer that stays nullptr
+// until an observer is registered, so unobserved runs pay one branch per
+// event site.
+class Probe {
+ public:
+  explicit Probe(DPUID dpu_id, std::vector<AccessObserver *> *observers)
+      : dpu_id_(dpu_id), cycle_(0), observers_(observers) {}
+  ~Probe() = default;
+
+  void set_cycle(SimTime cycle) { cycle_ = cycle; }
+
+  void dma_issue(ThreadID thread_id, DMAEvent::Operation operation,
+                 Address wram_address, Address mram_address, Address size) {
+    DMAEvent event{dpu_id_,      cycle_,       thread_id, operation,
+                   wram_address, mram_address, size};
+    for (auto &observer : *observers_) {
+      observer->on_dma_issue(event);
+    }
+  }
+  void dma_complete(ThreadID thread_id, DMAEvent::Operation operation,
+                    Address wram_address, Address mram_address,
+                    Address size) {
+    DMAEvent event{dpu_id_,      cycle_,       thread_id, operation,
+                   wram_address, mram_address, size};
+    for (auto &observer : *observers_) {
+      observer->on_dma_complete(event);
+    }
+  }
+
+  void memory_push(ThreadID thread_id, DMAEvent::Operation operation,
+                   Address wram_address, Address mram_address, Address size) {
+    DMAEvent event{dpu_id_,      cycle_,       thread_id, operation,
+                   wram_address, mram_address, size};
+    for (auto &observer : *observers_) {
+      observer->on_memory_push(event);
+    }
+  }
+  void memory_pop(ThreadID thread_id, DMAEvent::Operation operation,
+                  Address wram_address, Address mram_address, Address size) {
+    DMAEvent event{dpu_id_,      cycle_,       thread_id, operation,
+                   wram_address, mram_address, size};
+    for (auto &observer : *observers_) {
+      observer->on_memory_pop(event);
+    }
+  }
+  void memory_flush() {
+    FlushEvent event{dpu_id_, cycle_};
+    for (auto &observer : *observers_) {
+      observer->on_memory_flush(event);
+    }
+  }
+
+  void row_activate(Address row_address) {
+    RowEvent event{dpu_id_, cycle_, row_address};
+    for (auto &observer : *observers_) {
+      observer->on_row_activate(event);
+    }
+  }
+  void row_precharge(Address row_address) {
+    RowEvent event{dpu_id_, cycle_, row_address};
+    for (auto &observer : *observers_) {
+      observer->on_row_precharge(event);
+    }
+  }
+
+  void wram_load(ThreadID thread_id, Address address, Address size) {
+    WRAMEvent event{dpu_id_, cycle_, thread_id, address, size};
+    for (auto &observer : *observers_) {
+      observer->on_wram_load(event);
+    }
+  }
+  void wram_store(ThreadID thread_id, Address address, Address size) {
+    WRAMEvent event{dpu_id_, cycle_, thread_id, address, size};
+    for (auto &observer : *observers_) {
+      observer->on_wram_store(event);
+    }
+  }
+
+  void lock_acquire(ThreadID thread_id, Address lock_address, bool success) {
+    LockEvent event{dpu_id_, cycle_, thread_id, lock_address, success};
+    for (auto &observer : *observers_) {
+      observer->on_lock_acquire(event);
+    }
+  }
+  void lock_release(ThreadID thread_id, Address lock_address, bool success) {
+    LockEvent event{dpu_id_, cycle_, thread_id, lock_address, success};
+    for (auto &observer : *observers_) {
+      observer->on_lock_release(event);
+    }
+  }
+
+ private:
+  DPUID dpu_id_;
+  SimTime cycle_;
+  std::vector<AccessObserver *> *observers_;
+};
+
+}  // namespace upmem_sim::simulator::observer
+
+#endif
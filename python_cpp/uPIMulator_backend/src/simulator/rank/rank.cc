@@ -2,22 +2,38 @@
 
 namespace upmem_sim::simulator::rank {
 
-Rank::Rank(util::ArgumentParser* argument_parser)
-    : read_bandwidth_(
+Rank::Rank(int rank_id, Topology* topology, dram::PagePool* page_pool,
+           util::ArgumentParser* argument_parser)
+    : rank_id_(rank_id),
+      first_dpu_id_(topology->first_dpu_id(rank_id)),
+      read_bandwidth_(
           argument_parser->get_int_parameter("rank_read_bandwidth")),
       write_bandwidth_(
           argument_parser->get_int_parameter("rank_write_bandwidth")),
-      stat_factory_(new util::StatFactory("Rank")) {
+      lockstep_profile_(
+          argument_parser->get_int_parameter("lockstep_profile")),
+      rank_bus_(nullptr),
+      stat_factory_(
+          new util::StatFactory("Rank#" + std::to_string(rank_id))) {
   assert(read_bandwidth_ > 0);
   assert(write_bandwidth_ > 0);
 
-  int num_dpus =
-      static_cast<int>(argument_parser->get_int_parameter("num_dpus"));
+  std::string rank_transfer_model =
+      argument_parser->get_string_parameter("rank_transfer_model");
+  if (rank_transfer_model == "per_dpu") {
+    rank_bus_ = nullptr;
+  } else if (rank_transfer_model == "shared_bus") {
+    rank_bus_ = new RankBus(rank_id, topology, argument_parser);
+  } else {
+    throw std::invalid_argument("");
+  }
+
+  int num_dpus = topology->num_dpus(rank_id);
   dpus_.resize(num_dpus);
   communication_qs_.resize(num_dpus);
-  for (DPUID dpu_id = 0; dpu_id < num_dpus; dpu_id++) {
-    dpus_[dpu_id] = new dpu::DPU(dpu_id, argument_parser);
-    communication_qs_[dpu_id] = new basic::TimerQueue<RankMessage>(-1);
+  for (int i = 0; i < num_dpus; i++) {
+    dpus_[i] = new dpu::DPU(first_dpu_id_ + i, page_pool, argument_parser);
+    communication_qs_[i] = new basic::TimerQueue<RankMessage>(-1);
   }
 }
 
@@ -29,6 +45,7 @@ Rank::~Rank() {
   for (auto & communication_q : communication_qs_) {
     delete communication_q;
   }
+  delete rank_bus_;
 
   delete stat_factory_;
 }
@@ -38,6 +55,14 @@ util::StatFactory* Rank::stat_factory() {
 
   stat_factory->merge(stat_factory_);
 
+  if (rank_bus_ != nullptr) {
+    util::StatFactory* rank_bus_stat_factory = rank_bus_->stat_factory();
+
+    stat_factory->merge(rank_bus_stat_factory);
+
+    delete rank_bus_stat_factory;
+  }
+
   for (auto& dpu : dpus_) {
     util::StatFactory* dpu_stat_factory = dpu->stat_factory();
 
@@ -49,14 +74,40 @@ util::StatFactory* Rank::stat_factory() {
   return stat_factory;
 }
 
+util::StatTree* Rank::stat_tree() {
+  auto stat_tree = new util::StatTree(stat_factory_);
+  if (rank_bus_ != nullptr) {
+    stat_tree->add_child(rank_bus_->stat_tree());
+  }
+  for (auto& dpu : dpus_) {
+    stat_tree->add_child(dpu->stat_tree());
+  }
+  return stat_tree;
+}
+
+bool Rank::has_dpu(DPUID dpu_id) {
+  return first_dpu_id_ <= dpu_id and dpu_id < first_dpu_id_ + dpus_.size();
+}
+
+dpu::DPU* Rank::dpu(DPUID dpu_id) {
+  return dpus_[index(dpu_id)];
+}
+
 void Rank::launch() {
   for (auto& dpu : dpus_) {
-    for (auto& thread : dpu->scheduler()->threads()) {
-      Address bootstrap = util::ConfigLoader::iram_offset();
-      thread->reg_file()->write_pc_reg(bootstrap);
-    }
-    dpu->boot();
+    launch(dpu->dpu_id());
+  }
+}
+
+void Rank::launch(DPUID dpu_id) {
+  dpu::DPU* dpu = this->dpu(dpu_id);
+  for (auto& thread : dpu->scheduler()->threads()) {
+    Address bootstrap = util::ConfigLoader::iram_offset();
+    thread->reg_file()->write_pc_reg(bootstrap);
   }
+  // what the last execution and the host wrote may match other DPUs again
+  dpu->share_mram();
+  dpu->boot();
 }
 
 bool Rank::is_zombie() {
@@ -68,33 +119,70 @@ bool Rank::is_zombie() {
   return true;
 }
 
-void Rank::read(upmem_sim::simulator::rank::RankMessage*rank_message) {
+bool Rank::is_idle() {
+  for (auto& dpu : dpus_) {
+    if (not dpu->is_idle()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Rank::read(RankMessage* rank_message) {
   assert(rank_message->operation() == RankMessage::READ);
-  assert(0 <= rank_message->dpu_id() and rank_message->dpu_id() < dpus_.size());
 
-  basic::TimerQueue<RankMessage>* communication_q = communication_qs_[rank_message->dpu_id()];
-  assert(communication_q->can_push());
+  push({rank_message}, false);
+}
 
-  SimTime latency = static_cast<SimTime>(10 * rank_message->size() / read_bandwidth_);
-  communication_q->push(rank_message, latency);
+void Rank::write(RankMessage* rank_message) {
+  assert(rank_message->operation() == RankMessage::WRITE);
 
-  stat_factory_->increment("num_reads");
-  stat_factory_->increment("read_bytes", rank_message->size());
+  push({rank_message}, false);
 }
 
-void Rank::write(RankMessage*rank_message) {
-  assert(rank_message->operation() == RankMessage::WRITE);
-  assert(0 <= rank_message->dpu_id() and rank_message->dpu_id() < dpus_.size());
+void Rank::push_xfer(std::vector<RankMessage*> rank_messages) {
+  push(std::move(rank_messages), false);
+}
+
+void Rank::broadcast(std::vector<RankMessage*> rank_messages) {
+  for (auto& rank_message : rank_messages) {
+    assert(rank_message->operation() == RankMessage::WRITE);
+  }
+
+  push(std::move(rank_messages), true);
+}
 
+void Rank::push(std::vector<RankMessage*> rank_messages, bool broadcast) {
+  for (auto& rank_message : rank_messages) {
+    assert(has_dpu(rank_message->dpu_id()));
 
-  basic::TimerQueue<RankMessage>* communication_q = communication_qs_[rank_message->dpu_id()];
-  assert(communication_q->can_push());
+    if (rank_message->operation() == RankMessage::READ) {
+      stat_factory_->increment("num_reads");
+      stat_factory_->increment("read_bytes", rank_message->size());
+    } else if (rank_message->operation() == RankMessage::WRITE) {
+      stat_factory_->increment("num_writes");
+      stat_factory_->increment("write_bytes", rank_message->size());
+    } else {
+      throw std::invalid_argument("");
+    }
+  }
 
-  SimTime latency = static_cast<SimTime>(10 * rank_message->size() / write_bandwidth_);
-  communication_q->push(rank_message, latency);
+  if (rank_bus_ != nullptr) {
+    rank_bus_->push(new RankTransfer(std::move(rank_messages), broadcast));
+  } else {
+    for (auto& rank_message : rank_messages) {
+      basic::TimerQueue<RankMessage>* communication_q =
+          communication_qs_[index(rank_message->dpu_id())];
+      assert(communication_q->can_push());
 
-  stat_factory_->increment("num_writes");
-  stat_factory_->increment("write_bytes", rank_message->size());
+      Address bandwidth = rank_message->operation() == RankMessage::READ
+                              ? read_bandwidth_
+                              : write_bandwidth_;
+      SimTime latency =
+          static_cast<SimTime>(10 * rank_message->size() / bandwidth);
+      communication_q->push(rank_message, latency);
+    }
+  }
 }
 
 void Rank::cycle() {
@@ -103,6 +191,9 @@ void Rank::cycle() {
   for (auto& dpu : dpus_) {
     dpu->cycle();
   }
+  if (lockstep_profile_) {
+    update_lockstep();
+  }
 
   bool is_communication_q_empty = true;
   for (auto & communication_q : communication_qs_) {
@@ -113,8 +204,20 @@ void Rank::cycle() {
     }
   }
 
+  if (rank_bus_ != nullptr) {
+    if (not rank_bus_->empty()) {
+      is_communication_q_empty = false;
+    }
+
+    rank_bus_->cycle();
+  }
+
   if (not is_communication_q_empty) {
     stat_factory_->increment("communication_cycle");
+
+    if (not is_idle()) {
+      stat_factory_->increment("overlap_cycle");
+    }
   }
 
   stat_factory_->increment("rank_cycle");
@@ -129,4 +232,41 @@ void Rank::service_sequence_q() {
   }
 }
 
+void Rank::update_lockstep() {
+  // a cycle is in lockstep when every DPU that issued issued the same tasklet
+  // at the same pc, i.e. the issues could share one decode and dispatch
+  int num_issues = 0;
+  bool is_lockstep = true;
+  ThreadID thread_id = 0;
+  Address pc = 0;
+  for (auto& dpu : dpus_) {
+    dpu::Thread* thread = dpu->issued_thread();
+    if (thread == nullptr) {
+      continue;
+    }
+
+    if (num_issues == 0) {
+      thread_id = thread->id();
+      pc = dpu->issued_pc();
+    } else if (thread->id() != thread_id or dpu->issued_pc() != pc) {
+      is_lockstep = false;
+    }
+    num_issues++;
+  }
+
+  if (num_issues >= 2) {
+    if (is_lockstep) {
+      stat_factory_->increment("lockstep_cycle");
+      stat_factory_->increment("lockstep_issues", num_issues);
+    } else {
+      stat_factory_->increment("diverged_cycle");
+    }
+  }
+}
+
+int Rank::index(DPUID dpu_id) {
+  assert(has_dpu(dpu_id));
+  return dpu_id - first_dpu_id_;
+}
+
 }  // namespace upmem_sim::simulator::rank
@@ -6,36 +6,60 @@
 #include "main.h"
 #include "simulator/basic/timer_queue.h"
 #include "simulator/dpu/dpu.h"
+#include "simulator/rank/rank_bus.h"
 #include "simulator/rank/rank_message.h"
+#include "simulator/rank/topology.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator::rank {
 
 class Rank {
  public:
-  explicit Rank(util::ArgumentParser *argument_parser);
+  explicit Rank(int rank_id, Topology *topology, dram::PagePool *page_pool,
+                util::ArgumentParser *argument_parser);
   ~Rank();
 
+  int rank_id() { return rank_id_; }
+  SimTime rank_cycle() { return stat_factory_->value("rank_cycle"); }
+
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
 
   std::vector<dpu::DPU *> dpus() { return dpus_; }
+  bool has_dpu(DPUID dpu_id);
+  dpu::DPU *dpu(DPUID dpu_id);
 
   void launch();
+  void launch(DPUID dpu_id);
   bool is_zombie();
+  bool is_idle();
 
   void read(RankMessage *rank_message);
   void write(RankMessage *rank_message);
+  void push_xfer(std::vector<RankMessage *> rank_messages);
+  void broadcast(std::vector<RankMessage *> rank_messages);
 
   void cycle();
 
  protected:
+  void push(std::vector<RankMessage *> rank_messages, bool broadcast);
+
   void service_sequence_q();
+  void update_lockstep();
+
+  int index(DPUID dpu_id);
 
  private:
+  int rank_id_;
+  DPUID first_dpu_id_;
+
   Address read_bandwidth_;
   Address write_bandwidth_;
+  bool lockstep_profile_;
 
   std::vector<dpu::DPU *> dpus_;
   std::vector<basic::TimerQueue<RankMessage>*> communication_qs_;
+  RankBus *rank_bus_;
 
   util::StatFactory *stat_factory_;
 };
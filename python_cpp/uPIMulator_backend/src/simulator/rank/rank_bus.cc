@@ -0,0 +1,149 @@
+#include "simulator/rank/rank_bus.h"
+
+#include <algorithm>
+#include <map>
+
+namespace upmem_sim::simulator::rank {
+
+RankBus::RankBus(int rank_id, Topology *topology,
+                 util::ArgumentParser *argument_parser)
+    : topology_(topology),
+      bus_width_(static_cast<int>(
+          argument_parser->get_int_parameter("rank_bus_width"))),
+      burst_length_(static_cast<int>(
+          argument_parser->get_int_parameter("rank_burst_length"))),
+      logic_frequency_(static_cast<int>(
+          argument_parser->get_int_parameter("logic_frequency"))),
+      memory_frequency_(static_cast<int>(
+          argument_parser->get_int_parameter("memory_frequency"))),
+      beat_clock_(nullptr),
+      num_beats_(0),
+      transfer_q_(new basic::Queue<RankTransfer>(-1)),
+      cycle_(0),
+      stat_factory_(
+          new util::StatFactory("RankBus#" + std::to_string(rank_id))) {
+  assert(bus_width_ > 0);
+  assert(burst_length_ > 0);
+  assert(logic_frequency_ > 0);
+  assert(memory_frequency_ > 0);
+  assert(bus_width_ % topology_->num_chips_per_rank() == 0);
+
+  lane_width_ = bus_width_ / topology_->num_chips_per_rank();
+  assert(lane_width_ % 8 == 0);
+
+  reset_beat_clock();
+}
+
+RankBus::~RankBus() {
+  delete beat_clock_;
+  delete transfer_q_;
+
+  delete stat_factory_;
+}
+
+util::StatFactory *RankBus::stat_factory() {
+  auto stat_factory = new util::StatFactory("");
+
+  stat_factory->merge(stat_factory_);
+
+  return stat_factory;
+}
+
+util::StatTree *RankBus::stat_tree() {
+  return new util::StatTree(stat_factory_);
+}
+
+void RankBus::push(RankTransfer *rank_transfer) {
+  rank_transfer->set_num_beats(num_beats(rank_transfer));
+  rank_transfer->set_issue_cycle(cycle_);
+  transfer_q_->push(rank_transfer);
+
+  Address transfer_bytes = 0;
+  for (auto &rank_message : rank_transfer->rank_messages()) {
+    transfer_bytes += rank_message->size();
+  }
+
+  stat_factory_->increment("num_transfers");
+  if (rank_transfer->broadcast()) {
+    stat_factory_->increment("num_broadcasts");
+  }
+  stat_factory_->increment("transfer_bytes", transfer_bytes);
+  stat_factory_->increment("num_bursts",
+                           rank_transfer->num_beats() / burst_length_);
+  stat_factory_->increment("lane_bytes", rank_transfer->num_beats() *
+                                             bus_width_ / 8);
+}
+
+void RankBus::cycle() {
+  if (not transfer_q_->empty()) {
+    num_beats_ += beat_clock_->tick();
+    service_transfer_q();
+    stat_factory_->increment("bus_busy_cycle");
+  } else if (beat_clock_->reference_cycle() > 1) {
+    reset_beat_clock();
+  }
+
+  cycle_ += 1;
+}
+
+int64_t RankBus::num_bursts(Address size) {
+  Address burst_size = burst_length_ * lane_width_ / 8;
+  return (size + burst_size - 1) / burst_size;
+}
+
+int64_t RankBus::num_beats(RankTransfer *rank_transfer) {
+  if (rank_transfer->broadcast()) {
+    return num_bursts(rank_transfer->size()) * burst_length_;
+  }
+
+  std::map<int, Address> slot_sizes;
+  for (auto &rank_message : rank_transfer->rank_messages()) {
+    int slot = topology_->local_dpu_id(rank_message->dpu_id()) %
+               topology_->num_dpus_per_chip();
+    slot_sizes[slot] = std::max(slot_sizes[slot], rank_message->size());
+  }
+
+  int64_t num_beats = 0;
+  for (auto &[slot, size] : slot_sizes) {
+    num_beats += num_bursts(size) * burst_length_;
+  }
+  return num_beats;
+}
+
+void RankBus::reset_beat_clock() {
+  delete beat_clock_;
+  beat_clock_ = new basic::ClockDomain(memory_frequency_, logic_frequency_);
+  // a ClockDomain tick carries the edges at the start of its cycle; the bus
+  // counts a cycle's beats at its end, one tick later
+  beat_clock_->tick();
+
+  num_beats_ = 0;
+}
+
+void RankBus::service_transfer_q() {
+  while (not transfer_q_->empty() and num_beats_ > 0) {
+    RankTransfer *rank_transfer = transfer_q_->front();
+
+    int64_t num_beats = std::min(rank_transfer->num_beats(), num_beats_);
+    rank_transfer->set_num_beats(rank_transfer->num_beats() - num_beats);
+    num_beats_ -= num_beats;
+
+    if (rank_transfer->num_beats() == 0) {
+      transfer_q_->pop();
+
+      for (auto &rank_message : rank_transfer->rank_messages()) {
+        rank_message->set_ack();
+      }
+
+      SimTime latency = cycle_ + 1 - rank_transfer->issue_cycle();
+      stat_factory_->increment("transfer_latency", latency);
+      if (latency > stat_factory_->value("max_transfer_latency")) {
+        stat_factory_->overwrite("max_transfer_latency", latency);
+      }
+
+      delete rank_transfer;
+    }
+  }
+}
+
+}  // namespace upmem_sim::simulator::rank
@@ -0,0 +1,63 @@
+#ifndef UPMEM_SIM_SIMULATOR_RANK_RANK_BUS_H_
+#define UPMEM_SIM_SIMULATOR_RANK_RANK_BUS_H_
+
+#include "main.h"
+#include "simulator/basic/clock_domain.h"
+#include "simulator/basic/queue.h"
+#include "simulator/rank/rank_transfer.h"
+#include "simulator/rank/topology.h"
+#include "util/argument_parser.h"
+#include "util/stat_factory.h"
+#include "util/stat_tree.h"
+
+namespace upmem_sim::simulator::rank {
+
+// The host drives a single bus_width-bit bus per rank. Each chip owns a
+// bus_width / num_chips_per_rank-bit lane (the 8-bit-per-chip transposition),
+// so DPUs sharing a slot index in different chips are written in parallel and
+// DPUs of the same chip are serialized.
+class RankBus {
+ public:
+  explicit RankBus(int rank_id, Topology *topology,
+                   util::ArgumentParser *argument_parser);
+  ~RankBus();
+
+  util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
+
+  bool empty() { return transfer_q_->empty(); }
+
+  void push(RankTransfer *rank_transfer);
+  void cycle();
+
+ protected:
+  int64_t num_bursts(Address size);
+  int64_t num_beats(RankTransfer *rank_transfer);
+
+  void reset_beat_clock();
+  void service_transfer_q();
+
+ private:
+  Topology *topology_;
+
+  int bus_width_;
+  int burst_length_;
+  int lane_width_;
+
+  int logic_frequency_;
+  int memory_frequency_;
+  // restarts whenever the bus goes idle, so a busy period's k-th cycle ends
+  // with floor(k * memory_frequency / logic_frequency) beats delivered
+  basic::ClockDomain *beat_clock_;
+  int64_t num_beats_;
+
+  basic::Queue<RankTransfer> *transfer_q_;
+
+  SimTime cycle_;
+
+  util::StatFactory *stat_factory_;
+};
+
+}  // namespace upmem_sim::simulator::rank
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef UPMEM_SIM_SIMULATOR_RANK_RANK_TRANSFER_H_
+#define UPMEM_SIM_SIMULATOR_RANK_RANK_TRANSFER_H_
+
+#include <cassert>
+#include <vector>
+
+#include "main.h"
+#include "simulator/rank/rank_message.h"
+
+namespace upmem_sim::simulator::rank {
+
+class RankTransfer {
+ public:
+  explicit RankTransfer(std::vector<RankMessage*> rank_messages,
+                        bool broadcast)
+      : rank_messages_(std::move(rank_messages)),
+        broadcast_(broadcast),
+        num_beats_(0),
+        issue_cycle_(0) {
+    assert(not rank_messages_.empty());
+    for (auto& rank_message : rank_messages_) {
+      assert(rank_message->operation() == operation());
+      assert(not broadcast or rank_message->size() == size());
+    }
+  }
+  ~RankTransfer() = default;
+
+  std::vector<RankMessage*> rank_messages() { return rank_messages_; }
+
+  RankMessage::Operation operation() {
+    return rank_messages_[0]->operation();
+  }
+  bool broadcast() { return broadcast_; }
+  Address size() { return rank_messages_[0]->size(); }
+
+  int64_t num_beats() { return num_beats_; }
+  void set_num_beats(int64_t num_beats) { num_beats_ = num_beats; }
+
+  SimTime issue_cycle() { return issue_cycle_; }
+  void set_issue_cycle(SimTime issue_cycle) { issue_cycle_ = issue_cycle; }
+
+ private:
+  std::vector<RankMessage*> rank_messages_;
+  bool broadcast_;
+
+  int64_t num_beats_;
+  SimTime issue_cycle_;
+};
+
+}  // namespace upmem_sim::simulator::rank
+
+#endif
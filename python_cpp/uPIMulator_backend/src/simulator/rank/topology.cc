@@ -0,0 +1,46 @@
+#include "simulator/rank/topology.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace upmem_sim::simulator::rank {
+
+Topology::Topology(util::ArgumentParser *argument_parser)
+    : num_dpus_(
+          static_cast<int>(argument_parser->get_int_parameter("num_dpus"))),
+      num_dpus_per_rank_(static_cast<int>(
+          argument_parser->get_int_parameter("num_dpus_per_rank"))),
+      num_dpus_per_chip_(static_cast<int>(
+          argument_parser->get_int_parameter("num_dpus_per_chip"))) {
+  assert(num_dpus_ > 0);
+  assert(num_dpus_per_rank_ > 0);
+  assert(num_dpus_per_chip_ > 0);
+  assert(num_dpus_per_rank_ % num_dpus_per_chip_ == 0);
+
+  num_ranks_ = (num_dpus_ + num_dpus_per_rank_ - 1) / num_dpus_per_rank_;
+}
+
+int Topology::rank_id(DPUID dpu_id) {
+  assert(0 <= dpu_id and dpu_id < num_dpus_);
+  return dpu_id / num_dpus_per_rank_;
+}
+
+int Topology::chip_id(DPUID dpu_id) {
+  return local_dpu_id(dpu_id) / num_dpus_per_chip_;
+}
+
+DPUID Topology::local_dpu_id(DPUID dpu_id) {
+  assert(0 <= dpu_id and dpu_id < num_dpus_);
+  return dpu_id % num_dpus_per_rank_;
+}
+
+DPUID Topology::first_dpu_id(int rank_id) {
+  assert(0 <= rank_id and rank_id < num_ranks_);
+  return rank_id * num_dpus_per_rank_;
+}
+
+int Topology::num_dpus(int rank_id) {
+  return std::min(num_dpus_per_rank_, num_dpus_ - first_dpu_id(rank_id));
+}
+
+}  // namespace upmem_sim::simulator::rank
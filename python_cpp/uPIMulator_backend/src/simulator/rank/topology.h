@@ -0,0 +1,37 @@
+#ifndef UPMEM_SIM_SIMULATOR_RANK_TOPOLOGY_H_
+#define UPMEM_SIM_SIMULATOR_RANK_TOPOLOGY_H_
+
+#include "main.h"
+#include "util/argument_parser.h"
+
+namespace upmem_sim::simulator::rank {
+
+// ranks -> chips -> DPUs; DPUs are packed rank by rank
+class Topology {
+ public:
+  explicit Topology(util::ArgumentParser *argument_parser);
+  ~Topology() = default;
+
+  int num_dpus() { return num_dpus_; }
+  int num_ranks() { return num_ranks_; }
+  int num_dpus_per_rank() { return num_dpus_per_rank_; }
+  int num_dpus_per_chip() { return num_dpus_per_chip_; }
+  int num_chips_per_rank() { return num_dpus_per_rank_ / num_dpus_per_chip_; }
+
+  int rank_id(DPUID dpu_id);
+  int chip_id(DPUID dpu_id);
+  DPUID local_dpu_id(DPUID dpu_id);
+
+  DPUID first_dpu_id(int rank_id);
+  int num_dpus(int rank_id);
+
+ private:
+  int num_dpus_;
+  int num_ranks_;
+  int num_dpus_per_rank_;
+  int num_dpus_per_chip_;
+};
+
+}  // namespace upmem_sim::simulator::rank
+
+#endif
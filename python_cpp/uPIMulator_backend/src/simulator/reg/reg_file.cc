@@ -1,54 +1,67 @@
 #include "simulator/reg/reg_file.h"
 
-#include <stdexcept>
-#include <tuple>
+#include <algorithm>
+#include <cassert>
 
 namespace upmem_sim::simulator::reg {
 
+static_assert(abi::isa::LARGE < 64);
+static_assert(abi::isa::NOT_PROFILING < 16);
+static_assert(sizeof(upmem_translated_state::regs) / sizeof(uint32_t) ==
+              util::ConfigLoader::num_gp_registers() + abi::reg::ID8 + 1);
+
 RegFile::RegFile(ThreadID id)
-    : sp_reg_(new SPReg(id)),
-      pc_reg_(new PCReg()),
-      condition_reg_(new ConditionReg()),
-      flag_reg_(new FlagReg()),
-      exception_reg_(new ExceptionReg()) {
-  for (RegIndex index = 0; index < util::ConfigLoader::num_gp_registers();
-       index++) {
-    gp_regs_.push_back(new GPReg(index));
-  }
+    : pc_(0),
+      conditions_(uint64_t{1} << abi::isa::TRUE),
+      flags_(0),
+      exceptions_(0) {
+  regs_.fill(0);
+
+  RegIndex sp_regs = util::ConfigLoader::num_gp_registers();
+  regs_[sp_regs + abi::reg::ZERO] = 0;
+  regs_[sp_regs + abi::reg::ONE] = 1;
+  regs_[sp_regs + abi::reg::LNEG] = word(-1);
+  regs_[sp_regs + abi::reg::MNEG] = uint32_t{1} << 31;
+  regs_[sp_regs + abi::reg::ID] = word(id);
+  regs_[sp_regs + abi::reg::ID2] = word(2 * id);
+  regs_[sp_regs + abi::reg::ID4] = word(4 * id);
+  regs_[sp_regs + abi::reg::ID8] = word(8 * id);
+}
+
+void RegFile::set_condition(abi::isa::Condition condition) {
+  assert(condition != abi::isa::TRUE and condition != abi::isa::FALSE);
+  conditions_ |= uint64_t{1} << condition;
+}
+
+void RegFile::clear_condition(abi::isa::Condition condition) {
+  assert(condition != abi::isa::TRUE and condition != abi::isa::FALSE);
+  conditions_ &= ~(uint64_t{1} << condition);
 }
 
-RegFile::~RegFile() {
-  for (RegIndex index = 0; index < util::ConfigLoader::num_gp_registers();
-       index++) {
-    delete gp_regs_[index];
-  }
-  delete sp_reg_;
-  delete pc_reg_;
-  delete condition_reg_;
-  delete flag_reg_;
-  delete exception_reg_;
+void RegFile::save(upmem_translated_state *state) {
+  std::copy(regs_.begin(), regs_.end(), state->regs);
+  state->pc = pc_;
+  state->conditions = conditions_;
+  state->flags = flags_;
 }
 
-std::tuple<int64_t, int64_t> RegFile::read_pair_reg(
-    abi::reg::PairReg *pair_reg, abi::word::Representation representation) {
-  int64_t even = read_gp_reg(pair_reg->even_reg(), representation);
-  int64_t odd = read_gp_reg(pair_reg->odd_reg(), abi::word::UNSIGNED);
-  return {even, odd};
+void RegFile::restore(upmem_translated_state *state) {
+  std::copy(state->regs, state->regs + regs_.size(), regs_.begin());
+  conditions_ = state->conditions;
+  flags_ = state->flags;
 }
 
-int64_t RegFile::read_src_reg(abi::reg::SrcReg *src_reg,
-                              abi::word::Representation representation) {
-  if (src_reg->is_gp_reg()) {
-    return read_gp_reg(src_reg->gp_reg(), representation);
-  } else {
-    return read_sp_reg(*src_reg->sp_reg(), representation);
-  }
+void RegFile::fingerprint(std::vector<int64_t> *fingerprint) {
+  fingerprint->insert(fingerprint->end(), regs_.begin(), regs_.end());
+  fingerprint->push_back(pc_);
+  fingerprint->push_back(static_cast<int64_t>(conditions_));
+  fingerprint->push_back(flags_);
+  fingerprint->push_back(exceptions_);
 }
 
-void RegFile::write_pair_reg(abi::reg::PairReg *pair_reg, int64_t even,
-                             int64_t odd) {
-  write_gp_reg(pair_reg->even_reg(), even);
-  write_gp_reg(pair_reg->odd_reg(), odd);
+uint32_t RegFile::word(int64_t value) {
+  assert(-(int64_t{1} << 31) <= value and value < (int64_t{1} << 32));
+  return static_cast<uint32_t>(value);
 }
 
 }  // namespace upmem_sim::simulator::reg
@@ -1,78 +1,112 @@
 #ifndef UPMEM_SIM_SIMULATOR_REG_REG_FILE_H_
 #define UPMEM_SIM_SIMULATOR_REG_REG_FILE_H_
 
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "abi/isa/condition.h"
+#include "abi/isa/exception.h"
+#include "abi/isa/flag.h"
 #include "abi/reg/pair_reg.h"
 #include "abi/reg/src_reg.h"
-#include "simulator/reg/condition_reg.h"
-#include "simulator/reg/exception_reg.h"
-#include "simulator/reg/flag_reg.h"
-#include "simulator/reg/gp_reg.h"
-#include "simulator/reg/pc_reg.h"
-#include "simulator/reg/sp_reg.h"
+#include "abi/word/representation.h"
+#include "translator/translated_block.h"
 
 namespace upmem_sim::simulator::reg {
 
+// Per-tasklet architectural state kept as plain 32-bit words. The special
+// registers sit right after the GP registers so that a decoded SrcReg reads
+// through its flat index without branching on the operand kind.
 class RegFile {
  public:
   explicit RegFile(ThreadID id);
-  ~RegFile();
+  ~RegFile() = default;
 
   int64_t read_gp_reg(abi::reg::GPReg *gp_reg,
                       abi::word::Representation representation) {
-    return gp_regs_[gp_reg->index()]->read(representation);
+    return value(regs_[gp_reg->index()], representation);
   }
   int64_t read_sp_reg(abi::reg::SPReg sp_reg,
                       abi::word::Representation representation) {
-    return sp_reg_->read(sp_reg, representation);
+    return value(regs_[util::ConfigLoader::num_gp_registers() + sp_reg],
+                 representation);
   }
   std::tuple<int64_t, int64_t> read_pair_reg(
-      abi::reg::PairReg *pair_reg, abi::word::Representation representation);
+      abi::reg::PairReg *pair_reg, abi::word::Representation representation) {
+    return {read_gp_reg(pair_reg->even_reg(), representation),
+            read_gp_reg(pair_reg->odd_reg(), abi::word::UNSIGNED)};
+  }
   int64_t read_src_reg(abi::reg::SrcReg *src_reg,
-                       abi::word::Representation representation);
+                       abi::word::Representation representation) {
+    return value(regs_[src_reg->index()], representation);
+  }
 
-  int64_t read_pc_reg() { return pc_reg_->read(); }
+  int64_t read_pc_reg() { return pc_; }
   bool condition(abi::isa::Condition condition) {
-    return condition_reg_->condition(condition);
+    return (conditions_ >> condition) & 1;
   }
-  bool flag(abi::isa::Flag flag) { return flag_reg_->flag(flag); }
+  bool flag(abi::isa::Flag flag) { return (flags_ >> flag) & 1; }
   bool exception(abi::isa::Exception exception) {
-    return exception_reg_->exception(exception);
+    return (exceptions_ >> exception) & 1;
   }
 
   void write_gp_reg(abi::reg::GPReg *gp_reg, int64_t value) {
-    gp_regs_[gp_reg->index()]->write(value);
+    regs_[gp_reg->index()] = word(value);
   }
-  void write_pair_reg(abi::reg::PairReg *pair_reg, int64_t even, int64_t odd);
-  void write_pc_reg(int64_t value) { pc_reg_->write(value); }
-  void increment_pc_reg() { pc_reg_->increment(); }
-
-  void set_condition(abi::isa::Condition condition) {
-    condition_reg_->set_condition(condition);
+  void write_pair_reg(abi::reg::PairReg *pair_reg, int64_t even, int64_t odd) {
+    write_gp_reg(pair_reg->even_reg(), even);
+    write_gp_reg(pair_reg->odd_reg(), odd);
   }
-  void clear_condition(abi::isa::Condition condition) {
-    condition_reg_->clear_condition(condition);
+  void write_pc_reg(int64_t value) { pc_ = word(value); }
+  void increment_pc_reg() {
+    pc_ += util::ConfigLoader::iram_data_width() / 8;
   }
-  void clear_conditions() { condition_reg_->clear_conditions(); }
 
-  void set_flag(abi::isa::Flag flag) { flag_reg_->set_flag(flag); }
-  void clear_flag(abi::isa::Flag flag) { flag_reg_->clear_flag(flag); }
+  void set_condition(abi::isa::Condition condition);
+  void clear_condition(abi::isa::Condition condition);
+  void clear_conditions() { conditions_ = uint64_t{1} << abi::isa::TRUE; }
+
+  void set_flag(abi::isa::Flag flag) { flags_ |= 1 << flag; }
+  void clear_flag(abi::isa::Flag flag) { flags_ &= ~(1 << flag); }
 
   void set_exception(abi::isa::Exception exception) {
-    exception_reg_->set_exception(exception);
+    exceptions_ |= 1 << exception;
   }
   void clear_exception(abi::isa::Exception exception) {
-    exception_reg_->clear_exception(exception);
+    exceptions_ &= ~(1 << exception);
   }
 
+  // copies the registers, conditions and flags to and from the state a
+  // translated block runs on; the pc is left to the caller
+  void save(upmem_translated_state *state);
+  void restore(upmem_translated_state *state);
+
+  // appends the whole register file, pc included
+  void fingerprint(std::vector<int64_t> *fingerprint);
+
   void cycle() = delete;
 
+ protected:
+  static uint32_t word(int64_t value);
+  static int64_t value(uint32_t word,
+                       abi::word::Representation representation) {
+    if (representation == abi::word::SIGNED) {
+      return static_cast<int32_t>(word);
+    } else {
+      return word;
+    }
+  }
+
  private:
-  std::vector<GPReg *> gp_regs_;
-  SPReg *sp_reg_;
-  PCReg *pc_reg_;
-  ConditionReg *condition_reg_;
-  FlagReg *flag_reg_;
-  ExceptionReg *exception_reg_;
+  std::array<uint32_t,
+             util::ConfigLoader::num_gp_registers() + abi::reg::ID8 + 1>
+      regs_;
+  uint32_t pc_;
+  uint64_t conditions_;
+  uint8_t flags_;
+  uint16_t exceptions_;
 };
 
 }  // namespace upmem_sim::simulator::reg
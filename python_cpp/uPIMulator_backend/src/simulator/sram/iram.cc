@@ -10,44 +10,62 @@ IRAM::IRAM() {
 
   size_ = util::ConfigLoader::iram_size();
 
-  assert(address() % abi::word::InstructionWord().size() == 0);
-  assert(size_ % abi::word::InstructionWord().size() == 0);
+  assert(address() % instruction_word_size() == 0);
+  assert(size_ % instruction_word_size() == 0);
 
   cells_.resize(num_instruction_words());
   for (int i = 0; i < num_instruction_words(); i++) {
     cells_[i] = new abi::word::InstructionWord();
   }
+  instructions_.resize(num_instruction_words());
 }
 
 IRAM::~IRAM() {
   delete address_;
 
-  for (int i = 0; i < size_ / num_instruction_words(); i++) {
+  for (int i = 0; i < num_instruction_words(); i++) {
     delete cells_[i];
+    for (auto &instruction : instructions_[i]) {
+      delete instruction;
+    }
   }
 }
 
-abi::instruction::Instruction *IRAM::read(Address address) {
-  encoder::ByteStream *byte_stream = cells_[index(address)]->to_byte_stream();
-  abi::instruction::Instruction *instruction =
-      encoder::InstructionEncoder::decode(byte_stream);
-  delete byte_stream;
+abi::instruction::Instruction *IRAM::read(ThreadID thread_id,
+                                          Address address) {
+  std::vector<abi::instruction::Instruction *> &instructions =
+      instructions_[index(address)];
+  if (instructions.empty()) {
+    instructions.resize(util::ConfigLoader::max_num_tasklets(), nullptr);
+  }
+
+  abi::instruction::Instruction *&instruction = instructions[thread_id];
+  if (instruction == nullptr) {
+    encoder::ByteStream *byte_stream =
+        cells_[index(address)]->to_byte_stream();
+    instruction = encoder::InstructionEncoder::decode(byte_stream);
+    delete byte_stream;
+  }
   return instruction;
 }
 
 void IRAM::write(Address address, encoder::ByteStream *byte_stream) {
   cells_[index(address)]->from_byte_stream(byte_stream);
+
+  // only written while the DPU is idle, so no decoded copy is in flight
+  for (auto &instruction : instructions_[index(address)]) {
+    delete instruction;
+  }
+  instructions_[index(address)].clear();
 }
 
 int IRAM::index(Address address) {
   assert(address >= this->address());
-  assert(address + abi::word::InstructionWord().size() <=
-         this->address() + size_);
-  assert((address - this->address()) % abi::word::InstructionWord().size() ==
-         0);
+  assert(address + instruction_word_size() <= this->address() + size_);
+  assert((address - this->address()) % instruction_word_size() == 0);
 
   return static_cast<int>((address - this->address()) /
-                          abi::word::InstructionWord().size());
+                          instruction_word_size());
 }
 
 }  // namespace upmem_sim::simulator::sram
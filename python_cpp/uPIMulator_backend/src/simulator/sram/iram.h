@@ -15,14 +15,19 @@ class IRAM {
   Address address() { return address_->address(); }
   Address size() { return size_; }
 
-  abi::instruction::Instruction *read(Address address);
+  // Decoded once per tasklet and cell, then reused until the cell is written.
+  // The IRAM owns the instruction; it stays bound to thread_id.
+  abi::instruction::Instruction *read(ThreadID thread_id, Address address);
   void write(Address address, encoder::ByteStream *byte_stream);
   void cycle() = delete;
 
  protected:
-  static int num_instruction_words() {
+  static constexpr Address instruction_word_size() {
+    return util::ConfigLoader::iram_data_width() / 8;
+  }
+  static constexpr int num_instruction_words() {
     return static_cast<int>(util::ConfigLoader::iram_size() /
-                            abi::word::InstructionWord().size());
+                            instruction_word_size());
   }
   int index(Address address);
 
@@ -30,6 +35,8 @@ class IRAM {
   abi::word::InstructionAddressWord *address_;
   Address size_;
   std::vector<abi::word::InstructionWord *> cells_;
+  // per cell, per tasklet; empty until the cell is first read
+  std::vector<std::vector<abi::instruction::Instruction *>> instructions_;
 };
 
 }  // namespace upmem_sim::simulator::sram
@@ -8,42 +8,40 @@ WRAM::WRAM() {
 
   size_ = util::ConfigLoader::wram_size();
 
-  assert(address() % abi::word::DataWord().size() == 0);
-  assert(size_ % abi::word::DataWord().size() == 0);
+  assert(address() % data_word_size() == 0);
+  assert(size_ % data_word_size() == 0);
 
-  cells_.resize(num_data_words());
-  for (int i = 0; i < num_data_words(); i++) {
-    cells_[i] = new abi::word::DataWord();
-  }
+  cells_.resize(num_data_words(), 0);
 }
 
-WRAM::~WRAM() {
-  delete address_;
+WRAM::~WRAM() { delete address_; }
 
-  for (int i = 0; i < num_data_words(); i++) {
-    delete cells_[i];
-  }
-}
-
-int64_t WRAM::read(Address address) {
-  return cells_[index(address)]->value(abi::word::UNSIGNED);
-}
+int64_t WRAM::read(Address address) { return cells_[index(address)]; }
 
 void WRAM::write(Address address, int64_t value) {
-  cells_[index(address)]->set_value(value);
+  assert(-(int64_t{1} << 31) <= value and value < (int64_t{1} << 32));
+
+  cells_[index(address)] = static_cast<uint32_t>(value);
 }
 
 void WRAM::write(Address address, encoder::ByteStream *byte_stream) {
-  cells_[index(address)]->from_byte_stream(byte_stream);
+  assert(byte_stream->size() <= data_word_size());
+
+  uint32_t &cell = cells_[index(address)];
+  for (int i = 0; i < byte_stream->size(); i++) {
+    auto byte = static_cast<uint32_t>(byte_stream->byte(i));
+    assert(byte < 256);
+
+    cell = (cell & ~(uint32_t{0xFF} << (8 * i))) | (byte << (8 * i));
+  }
 }
 
 int WRAM::index(Address address) {
   assert(address >= this->address());
-  assert(address + abi::word::DataWord().size() <= this->address() + size_);
-  assert((address - this->address()) % abi::word::DataWord().size() == 0);
+  assert(address + data_word_size() <= this->address() + size_);
+  assert((address - this->address()) % data_word_size() == 0);
 
-  return static_cast<int>((address - this->address()) /
-                          abi::word::DataWord().size());
+  return static_cast<int>((address - this->address()) / data_word_size());
 }
 
-}  // namespace upmem_sim::simulator::sram
\ No newline at end of file
+}  // namespace upmem_sim::simulator::sram
@@ -22,16 +22,21 @@ class WRAM {
   void cycle() = delete;
 
  protected:
-  static int num_data_words() {
+  static constexpr Address data_word_size() {
+    return util::ConfigLoader::wram_data_width() / 8;
+  }
+  static constexpr int num_data_words() {
     return static_cast<int>(util::ConfigLoader::wram_size() /
-                            abi::word::DataWord().size());
+                            data_word_size());
   }
   int index(Address address);
 
  private:
+  static_assert(util::ConfigLoader::wram_data_width() == 32);
+
   abi::word::DataAddressWord *address_;
   Address size_;
-  std::vector<abi::word::DataWord *> cells_;
+  std::vector<uint32_t> cells_;
 };
 
 }  // namespace upmem_sim::simulator::sram
@@ -1,48 +1,261 @@
 #include "simulator/system.h"
 
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
 namespace upmem_sim::simulator {
 
 System::System(util::ArgumentParser *argument_parser)
     : cpu_(new cpu::CPU(argument_parser)),
-      rank_(new rank::Rank(argument_parser)),
-      execuion_(0), 
+      topology_(new rank::Topology(argument_parser)),
+      page_pool_(new dram::PagePool()),
+      trace_writer_(nullptr),
+      block_library_(nullptr),
+      access_log_sink_(nullptr),
+      memory_trace_sink_(nullptr),
+      host_profiler_(nullptr),
+      stat_series_(nullptr),
+      host_model_(argument_parser->get_string_parameter("host_model")),
+      num_host_threads_(static_cast<int>(
+          argument_parser->get_int_parameter("num_host_threads"))),
+      host_quantum_(argument_parser->get_int_parameter("host_quantum")),
+      quantum_barrier_(nullptr),
+      is_stopping_(false),
+      execuion_(0),
       stat_factory_(new util::StatFactory("System")) {
+  assert(num_host_threads_ > 0);
+  assert(host_quantum_ > 0);
+
   benchmark = argument_parser->get_string_parameter("benchmark");
 
-  cpu_->connect_rank(rank_);
+  cpu_->connect_topology(topology_);
+
+  ranks_.resize(topology_->num_ranks());
+  for (int rank_id = 0; rank_id < topology_->num_ranks(); rank_id++) {
+    ranks_[rank_id] =
+        new rank::Rank(rank_id, topology_, page_pool_, argument_parser);
+    cpu_->connect_rank(ranks_[rank_id]);
+  }
+
+  std::string trace = argument_parser->get_string_parameter("trace");
+  if (not trace.empty()) {
+    trace_writer_ = new tracer::TraceWriter(trace, topology_->num_dpus());
+    for (auto &rank : ranks_) {
+      for (auto &dpu : rank->dpus()) {
+        dpu->connect_trace_ring(trace_writer_->ring(dpu->dpu_id()));
+      }
+    }
+  }
+
+  std::string translated_blocks =
+      argument_parser->get_string_parameter("translated_blocks");
+  if (not translated_blocks.empty()) {
+    block_library_ = new translator::BlockLibrary(translated_blocks);
+    for (auto &rank : ranks_) {
+      for (auto &dpu : rank->dpus()) {
+        dpu->connect_block_library(block_library_);
+      }
+    }
+  }
+
+  std::string access_log = argument_parser->get_string_parameter("access_log");
+  if (not access_log.empty()) {
+    access_log_sink_ = new observer::AccessLogSink(access_log);
+    register_observer(access_log_sink_);
+  }
+
+  std::string memory_trace =
+      argument_parser->get_string_parameter("memory_trace");
+  if (not memory_trace.empty()) {
+    memory_trace_sink_ = new observer::MemoryTraceSink(memory_trace);
+    register_observer(memory_trace_sink_);
+  }
+
+  if (argument_parser->get_int_parameter("host_profile")) {
+    host_profiler_ = new util::HostProfiler(
+        topology_->num_dpus(),
+        argument_parser->get_int_parameter("host_profile_interval"));
+    for (auto &rank : ranks_) {
+      for (auto &dpu : rank->dpus()) {
+        dpu->connect_host_timer(host_profiler_->timer(dpu->dpu_id()));
+      }
+    }
+  }
+
+  SimTime stats_interval = argument_parser->get_int_parameter("stats_interval");
+  if (stats_interval > 0) {
+    stat_series_ = new util::StatSeries(
+        argument_parser->get_string_parameter("stats_series"), stats_interval);
+  }
+
+  // the host script steps all ranks in lockstep on the calling thread
+  if (num_host_threads_ > 1 and host_model_ != "script") {
+    quantum_barrier_ = new std::barrier<>(num_host_threads_);
+    for (int host_thread_id = 1; host_thread_id < num_host_threads_;
+         host_thread_id++) {
+      host_threads_.emplace_back(
+          [this, host_thread_id]() { run_host_thread(host_thread_id); });
+    }
+  }
 }
 
 System::~System() {
+  if (quantum_barrier_ != nullptr) {
+    is_stopping_ = true;
+    quantum_barrier_->arrive_and_wait();
+    for (auto &host_thread : host_threads_) {
+      host_thread.join();
+    }
+    delete quantum_barrier_;
+  }
+
   delete cpu_;
-  delete rank_;
+
+  for (auto &rank : ranks_) {
+    delete rank;
+  }
+  delete topology_;
+  // after the ranks, whose wordlines release their pages into it
+  delete page_pool_;
+
+  delete trace_writer_;
+  delete block_library_;
+
+  for (auto &probe : probes_) {
+    delete probe;
+  }
+  delete access_log_sink_;
+  delete memory_trace_sink_;
+  delete host_profiler_;
+  delete stat_series_;
 
   delete stat_factory_;
 }
 
+void System::register_observer(observer::AccessObserver *observer) {
+  assert(observer != nullptr);
+
+  if (probes_.empty()) {
+    for (auto &rank : ranks_) {
+      for (auto &dpu : rank->dpus()) {
+        auto probe = new observer::Probe(dpu->dpu_id(), &observers_);
+        dpu->connect_probe(probe);
+        probes_.push_back(probe);
+      }
+    }
+  }
+
+  observers_.push_back(observer);
+}
+
+void System::report_host_profile(std::ostream &os) {
+  if (host_profiler_ != nullptr) {
+    host_profiler_->report(os, num_instructions());
+  }
+}
+
 util::StatFactory *System::stat_factory() {
   auto stat_factory = new util::StatFactory("");
 
-  util::StatFactory *rank_stat_factory = rank_->stat_factory();
+  update_end_to_end_cycle();
+  update_mram_pages();
 
   stat_factory->merge(stat_factory_);
-  stat_factory->merge(rank_stat_factory);
 
-  delete rank_stat_factory;
+  for (auto &rank : ranks_) {
+    util::StatFactory *rank_stat_factory = rank->stat_factory();
+
+    stat_factory->merge(rank_stat_factory);
+
+    delete rank_stat_factory;
+  }
 
   return stat_factory;
 }
 
+util::StatTree *System::stat_tree() {
+  update_end_to_end_cycle();
+  update_mram_pages();
+
+  auto stat_tree = new util::StatTree(stat_factory_);
+  for (auto &rank : ranks_) {
+    stat_tree->add_child(rank->stat_tree());
+  }
+  return stat_tree;
+}
+
+SimTime System::end_to_end_cycle() {
+  SimTime end_to_end_cycle = 0;
+  for (auto &rank : ranks_) {
+    end_to_end_cycle = std::max(end_to_end_cycle, rank->rank_cycle());
+  }
+  return end_to_end_cycle;
+}
+
+void System::update_end_to_end_cycle() {
+  stat_factory_->overwrite("end_to_end_cycle", end_to_end_cycle());
+}
+
+void System::update_mram_pages() {
+  // distinct wordline images held across all MRAMs; wordlines never written
+  // read as zeros and hold none
+  stat_factory_->overwrite("mram_pages", page_pool_->num_pages());
+}
+
+void System::record_stat_series() {
+  util::StatFactory *stat_factory = this->stat_factory();
+  stat_series_->record(stat_factory);
+  delete stat_factory;
+}
+
 void System::init() {
+  if (host_model_ == "script") {
+    return;
+  }
+
   cpu_->init();
   cpu_->sched(execuion_);
   cpu_->launch();
 }
 
+void System::fini() {
+  cpu_->fini();
+
+  for (auto &rank : ranks_) {
+    for (auto &dpu : rank->dpus()) {
+      dpu->share_mram();
+    }
+  }
+
+  if (memory_trace_sink_ != nullptr) {
+    for (auto &rank : ranks_) {
+      for (auto &dpu : rank->dpus()) {
+        memory_trace_sink_->end(dpu->dpu_id(), dpu->num_cycles());
+      }
+    }
+  }
+
+  // the last partial interval, so that the deltas add up to the final stats
+  if (stat_series_ != nullptr) {
+    stat_series_->cycle(end_to_end_cycle());
+    record_stat_series();
+  }
+}
+
+bool System::is_finished() {
+  if (host_model_ == "async" or host_model_ == "script") {
+    return cpu_->is_finished();
+  } else {
+    return execuion_ == cpu_->num_executions();
+  }
+}
+
 void System::cycle() {
   cpu_->cycle();
-  rank_->cycle();
+  cycle_ranks();
 
-  if (is_zombie()) {
+  if (host_model_ == "sync" and is_zombie()) {
     cpu_->check(execuion_);
     execuion_ += 1;
 
@@ -54,6 +267,83 @@ void System::cycle() {
       cpu_->launch();
     }
   }
+
+  if (host_profiler_ != nullptr and
+      host_profiler_->cycle(end_to_end_cycle())) {
+    host_profiler_->report_interval(std::cerr, num_instructions());
+  }
+
+  if (stat_series_ != nullptr and stat_series_->cycle(end_to_end_cycle())) {
+    record_stat_series();
+  }
+}
+
+bool System::is_zombie() {
+  for (auto &rank : ranks_) {
+    if (not rank->is_zombie()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool System::is_running(rank::Rank *rank) {
+  if (host_model_ == "async" or host_model_ == "script") {
+    return not cpu_->is_finished(rank);
+  } else {
+    return not rank->is_zombie();
+  }
+}
+
+int64_t System::num_instructions() {
+  int64_t num_instructions = 0;
+  for (auto &rank : ranks_) {
+    for (auto &dpu : rank->dpus()) {
+      num_instructions += dpu->num_instructions();
+    }
+  }
+  return num_instructions;
+}
+
+void System::cycle_ranks() {
+  if (quantum_barrier_ == nullptr) {
+    for (auto &rank : ranks_) {
+      if (is_running(rank)) {
+        cpu_->cycle(rank);
+        rank->cycle();
+      }
+    }
+  } else {
+    // every host thread runs its ranks for one quantum, then all meet again
+    // so that the host side sees the ranks at most a quantum apart
+    quantum_barrier_->arrive_and_wait();
+    cycle_ranks(0);
+    quantum_barrier_->arrive_and_wait();
+  }
+}
+
+void System::cycle_ranks(int host_thread_id) {
+  for (int rank_id = host_thread_id; rank_id < ranks_.size();
+       rank_id += num_host_threads_) {
+    rank::Rank *rank = ranks_[rank_id];
+    for (SimTime cycle = 0; cycle < host_quantum_ and is_running(rank);
+         cycle++) {
+      cpu_->cycle(rank);
+      rank->cycle();
+    }
+  }
+}
+
+void System::run_host_thread(int host_thread_id) {
+  while (true) {
+    quantum_barrier_->arrive_and_wait();
+    if (is_stopping_) {
+      return;
+    }
+
+    cycle_ranks(host_thread_id);
+    quantum_barrier_->arrive_and_wait();
+  }
 }
 
 }  // namespace upmem_sim::simulator
@@ -1,9 +1,23 @@
 #ifndef UPMEM_SIM_SIMULATOR_SYSTEM_H_
 #define UPMEM_SIM_SIMULATOR_SYSTEM_H_
 
+#include <barrier>
+#include <thread>
+#include <vector>
+
 #include "simulator/cpu/cpu.h"
 #include "simulator/dpu/dpu.h"
+#include "simulator/dram/page_pool.h"
+#include "simulator/observer/access_log_sink.h"
+#include "simulator/observer/memory_trace_sink.h"
+#include "simulator/observer/probe.h"
 #include "simulator/rank/rank.h"
+#include "simulator/rank/topology.h"
+#include "tracer/trace_writer.h"
+#include "translator/block_library.h"
+#include "util/host_profiler.h"
+#include "util/stat_series.h"
+#include "util/stat_tree.h"
 
 namespace upmem_sim::simulator {
 
@@ -13,19 +27,57 @@ class System {
   ~System();
 
   util::StatFactory *stat_factory();
+  util::StatTree *stat_tree();
+
+  bool is_finished();
 
-  bool is_finished() { return execuion_ == cpu_->num_executions(); }
+  // observers are not owned; register before the first cycle
+  void register_observer(observer::AccessObserver *observer);
+
+  // no-op unless --host_profile is set
+  void report_host_profile(std::ostream &os);
 
   void init();
-  void fini() { cpu_->fini(); }
+  void fini();
   void cycle();
 
  protected:
-  bool is_zombie() { return rank_->is_zombie(); }
+  SimTime end_to_end_cycle();
+  void update_end_to_end_cycle();
+  void update_mram_pages();
+
+  bool is_zombie();
+  bool is_running(rank::Rank *rank);
+  int64_t num_instructions();
+  void record_stat_series();
+
+  void cycle_ranks();
+  void cycle_ranks(int host_thread_id);
+  void run_host_thread(int host_thread_id);
 
  private:
   cpu::CPU *cpu_;
-  rank::Rank *rank_;
+  rank::Topology *topology_;
+  dram::PagePool *page_pool_;
+  std::vector<rank::Rank *> ranks_;
+  tracer::TraceWriter *trace_writer_;
+  translator::BlockLibrary *block_library_;
+
+  std::vector<observer::AccessObserver *> observers_;
+  std::vector<observer::Probe *> probes_;
+  observer::AccessLogSink *access_log_sink_;
+  observer::MemoryTraceSink *memory_trace_sink_;
+  util::HostProfiler *host_profiler_;
+  util::StatSeries *stat_series_;
+
+  std::string host_model_;
+  int num_host_threads_;
+  SimTime host_quantum_;
+  // the calling thread is host thread 0; the others live as long as the
+  // System and meet it at the barrier before and after every quantum
+  std::vector<std::thread> host_threads_;
+  std::barrier<> *quantum_barrier_;
+  bool is_stopping_;
 
   int execuion_;
 
@@ -0,0 +1,68 @@
+#include "tracer/trace_reader.h"
+
+#include <zlib.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace upmem_sim::tracer {
+
+TraceReader::TraceReader(std::string filepath)
+    : ifs_(filepath, std::ios::binary), index_(0) {
+  TraceHeader header;
+  if (not ifs_.read(reinterpret_cast<char *>(&header), sizeof(header)) or
+      std::memcmp(header.magic, "UPMT", 4) != 0 or
+      header.version != trace_version or
+      header.record_size != sizeof(TraceRecord)) {
+    throw std::invalid_argument("");
+  }
+}
+
+bool TraceReader::is_trace(std::string filepath) {
+  std::ifstream ifs(filepath, std::ios::binary);
+  char magic[4];
+  return ifs.read(magic, sizeof(magic)) and std::memcmp(magic, "UPMT", 4) == 0;
+}
+
+void TraceReader::decode_block(const char *compressed, size_t compressed_size,
+                               uint32_t num_records,
+                               std::vector<TraceRecord> &records) {
+  records.resize(num_records);
+  uLongf size = records.size() * sizeof(TraceRecord);
+  if (uncompress(reinterpret_cast<Bytef *>(records.data()), &size,
+                 reinterpret_cast<const Bytef *>(compressed),
+                 compressed_size) != Z_OK or
+      size != records.size() * sizeof(TraceRecord)) {
+    throw std::runtime_error("");
+  }
+}
+
+bool TraceReader::next(TraceRecord &record) {
+  if (index_ == block_.size()) {
+    if (not next_block(block_)) {
+      return false;
+    }
+    index_ = 0;
+  }
+
+  record = block_[index_++];
+  return true;
+}
+
+bool TraceReader::next_block(std::vector<TraceRecord> &records) {
+  uint32_t block_header[2];
+  if (not ifs_.read(reinterpret_cast<char *>(block_header),
+                    sizeof(block_header))) {
+    return false;
+  }
+
+  std::vector<char> compressed(block_header[1]);
+  if (not ifs_.read(compressed.data(), compressed.size())) {
+    throw std::runtime_error("");
+  }
+
+  decode_block(compressed.data(), compressed.size(), block_header[0], records);
+  return not records.empty();
+}
+
+}  // namespace upmem_sim::tracer
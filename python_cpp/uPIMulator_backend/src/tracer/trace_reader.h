@@ -0,0 +1,39 @@
+#ifndef UPMEM_SIM_TRACER_TRACE_READER_H_
+#define UPMEM_SIM_TRACER_TRACE_READER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "tracer/trace_record.h"
+
+// NOTE: shared with tools/upmem_profiler; depends on the standard library and
+// zlib only
+namespace upmem_sim::tracer {
+
+class TraceReader {
+ public:
+  explicit TraceReader(std::string filepath);
+  ~TraceReader() = default;
+
+  static bool is_trace(std::string filepath);
+
+  // blocks follow the TraceHeader as {uint32 num_records,
+  // uint32 compressed_size, zlib data}
+  static void decode_block(const char *compressed, size_t compressed_size,
+                           uint32_t num_records,
+                           std::vector<TraceRecord> &records);
+
+  bool next(TraceRecord &record);
+  bool next_block(std::vector<TraceRecord> &records);
+
+ private:
+  std::ifstream ifs_;
+
+  std::vector<TraceRecord> block_;
+  size_t index_;
+};
+
+}  // namespace upmem_sim::tracer
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef UPMEM_SIM_TRACER_TRACE_RECORD_H_
+#define UPMEM_SIM_TRACER_TRACE_RECORD_H_
+
+#include <cstdint>
+
+// NOTE: shared with tools/upmem_profiler; depends on the standard library only
+namespace upmem_sim::tracer {
+
+// trace file: TraceHeader, then blocks of
+//   uint32_t num_records, uint32_t compressed_size, zlib-compressed records
+struct TraceHeader {
+  char magic[4];  // "UPMT"
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t reserved;
+};
+
+// one issued instruction; op_code and suffix are abi::instruction enum values
+struct TraceRecord {
+  enum OperandMask : uint8_t { RA = 1, RB = 2, IMM = 4 };
+
+  uint64_t cycle;
+  uint32_t dpu_id;
+  uint32_t pc;
+  uint8_t thread_id;
+  uint8_t op_code;
+  uint8_t suffix;
+  uint8_t operand_mask;
+  int32_t imm;
+  int64_t ra;
+  int64_t rb;
+
+  // registers written by the instruction (rc, or both halves of dc)
+  uint8_t num_reg_deltas;
+  uint8_t reg_delta_indices[2];
+  uint8_t padding[5];
+  uint32_t reg_delta_values[2];
+
+  // stall cycles the thread accumulated since its previous traced instruction
+  uint32_t wait_data_cycles;
+  uint32_t wait_schedule_cycles;
+  uint32_t cycle_rule_cycles;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(TraceRecord) == 72);
+
+constexpr uint32_t trace_version = 2;
+
+}  // namespace upmem_sim::tracer
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef UPMEM_SIM_TRACER_TRACE_RING_H_
+#define UPMEM_SIM_TRACER_TRACE_RING_H_
+
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+#include "tracer/trace_record.h"
+
+namespace upmem_sim::tracer {
+
+// single-producer (the DPU's host thread), single-consumer (the writer)
+class TraceRing {
+ public:
+  explicit TraceRing(int size) : records_(size), head_(0), tail_(0) {
+    assert(size > 0 and (size & (size - 1)) == 0);
+  }
+  ~TraceRing() = default;
+
+  void push(const TraceRecord &record) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    while (tail - head_.load(std::memory_order_acquire) == records_.size()) {
+      std::this_thread::yield();
+    }
+
+    records_[tail & (records_.size() - 1)] = record;
+    tail_.store(tail + 1, std::memory_order_release);
+  }
+
+  int pop(TraceRecord *records, int max_num_records) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    size_t tail = tail_.load(std::memory_order_acquire);
+
+    int num_records = 0;
+    while (head != tail and num_records < max_num_records) {
+      records[num_records++] = records_[head & (records_.size() - 1)];
+      head += 1;
+    }
+
+    head_.store(head, std::memory_order_release);
+    return num_records;
+  }
+
+ private:
+  std::vector<TraceRecord> records_;
+
+  alignas(64) std::atomic<size_t> head_;
+  alignas(64) std::atomic<size_t> tail_;
+};
+
+}  // namespace upmem_sim::tracer
+
+#endif
@@ -0,0 +1,95 @@
+#include "tracer/trace_writer.h"
+
+#include <zlib.h>
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace upmem_sim::tracer {
+
+TraceWriter::TraceWriter(std::string filepath, int num_dpus)
+    : ofs_(filepath, std::ios::binary), block_size_(0), stop_(false) {
+  if (not ofs_.is_open()) {
+    throw std::invalid_argument("");
+  }
+
+  TraceHeader header;
+  std::memcpy(header.magic, "UPMT", 4);
+  header.version = trace_version;
+  header.record_size = sizeof(TraceRecord);
+  header.reserved = 0;
+  ofs_.write(reinterpret_cast<char *>(&header), sizeof(header));
+
+  rings_.resize(num_dpus);
+  for (auto &ring : rings_) {
+    ring = new TraceRing(1 << 14);
+  }
+  block_.resize(1 << 14);
+
+  writer_ = std::thread([this]() { run(); });
+}
+
+TraceWriter::~TraceWriter() {
+  stop_.store(true);
+  writer_.join();
+
+  for (auto &ring : rings_) {
+    delete ring;
+  }
+}
+
+void TraceWriter::run() {
+  while (true) {
+    // read stop_ before draining so that nothing pushed before it is lost
+    bool stop = stop_.load();
+
+    int num_records = 0;
+    for (auto &ring : rings_) {
+      while (true) {
+        int n = ring->pop(block_.data() + block_size_,
+                          static_cast<int>(block_.size()) - block_size_);
+        block_size_ += n;
+        num_records += n;
+        if (block_size_ == block_.size()) {
+          flush();
+        }
+        if (n == 0) {
+          break;
+        }
+      }
+    }
+
+    if (num_records == 0) {
+      if (stop) {
+        flush();
+        return;
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  }
+}
+
+void TraceWriter::flush() {
+  if (block_size_ == 0) {
+    return;
+  }
+
+  uLong size = block_size_ * sizeof(TraceRecord);
+  uLongf compressed_size = compressBound(size);
+  std::vector<Bytef> compressed(compressed_size);
+  if (compress2(compressed.data(), &compressed_size,
+                reinterpret_cast<Bytef *>(block_.data()), size,
+                Z_BEST_SPEED) != Z_OK) {
+    throw std::runtime_error("");
+  }
+
+  uint32_t block_header[2] = {static_cast<uint32_t>(block_size_),
+                              static_cast<uint32_t>(compressed_size)};
+  ofs_.write(reinterpret_cast<char *>(block_header), sizeof(block_header));
+  ofs_.write(reinterpret_cast<char *>(compressed.data()), compressed_size);
+
+  block_size_ = 0;
+}
+
+}  // namespace upmem_sim::tracer
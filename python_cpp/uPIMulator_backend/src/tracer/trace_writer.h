@@ -0,0 +1,40 @@
+#ifndef UPMEM_SIM_TRACER_TRACE_WRITER_H_
+#define UPMEM_SIM_TRACER_TRACE_WRITER_H_
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tracer/trace_record.h"
+#include "tracer/trace_ring.h"
+
+namespace upmem_sim::tracer {
+
+// drains the per-DPU rings in the background and writes compressed blocks
+class TraceWriter {
+ public:
+  explicit TraceWriter(std::string filepath, int num_dpus);
+  ~TraceWriter();
+
+  TraceRing *ring(int dpu_id) { return rings_[dpu_id]; }
+
+ protected:
+  void run();
+  void flush();
+
+ private:
+  std::ofstream ofs_;
+  std::vector<TraceRing *> rings_;
+
+  std::vector<TraceRecord> block_;
+  int block_size_;
+
+  std::atomic<bool> stop_;
+  std::thread writer_;
+};
+
+}  // namespace upmem_sim::tracer
+
+#endif
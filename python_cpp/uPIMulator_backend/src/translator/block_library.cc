@@ -0,0 +1,27 @@
+#include "translator/block_library.h"
+
+#include <dlfcn.h>
+
+#include <iostream>
+#include <stdexcept>
+
+namespace upmem_sim::translator {
+
+BlockLibrary::BlockLibrary(std::string path)
+    : handle_(dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL)), lookup_(nullptr) {
+  if (handle_ == nullptr) {
+    std::cerr << dlerror() << std::endl;
+    throw std::invalid_argument("");
+  }
+
+  lookup_ = reinterpret_cast<upmem_translated_block_lookup>(
+      dlsym(handle_, "upmem_translated_block_at"));
+  if (lookup_ == nullptr) {
+    std::cerr << dlerror() << std::endl;
+    throw std::invalid_argument("");
+  }
+}
+
+BlockLibrary::~BlockLibrary() { dlclose(handle_); }
+
+}  // namespace upmem_sim::translator
@@ -0,0 +1,27 @@
+#ifndef UPMEM_SIM_TRANSLATOR_BLOCK_LIBRARY_H_
+#define UPMEM_SIM_TRANSLATOR_BLOCK_LIBRARY_H_
+
+#include <string>
+
+#include "main.h"
+#include "translator/translated_block.h"
+
+namespace upmem_sim::translator {
+
+// A shared library built from BlockTranslator output, opened with dlopen.
+// block_at returns nullptr where the interpreter has to run the instruction.
+class BlockLibrary {
+ public:
+  explicit BlockLibrary(std::string path);
+  ~BlockLibrary();
+
+  upmem_translated_block block_at(Address pc) { return lookup_(pc); }
+
+ private:
+  void *handle_;
+  upmem_translated_block_lookup lookup_;
+};
+
+}  // namespace upmem_sim::translator
+
+#endif
@@ -0,0 +1,236 @@
+#include "translator/block_translator.h"
+
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+#include "abi/word/instruction_word.h"
+#include "converter/op_code_converter.h"
+#include "converter/suffix_converter.h"
+#include "encoder/instruction_encoder.h"
+#include "util/config_loader.h"
+
+namespace upmem_sim::translator {
+
+BlockTranslator::BlockTranslator(encoder::ByteStream *iram_byte_stream) {
+  constexpr Address instruction_size =
+      util::ConfigLoader::iram_data_width() / 8;
+  assert(iram_byte_stream->size() % instruction_size == 0);
+
+  for (Address begin = 0; begin < iram_byte_stream->size();
+       begin += instruction_size) {
+    encoder::ByteStream *byte_stream =
+        iram_byte_stream->slice(static_cast<int>(begin),
+                                static_cast<int>(begin + instruction_size));
+    instructions_.push_back(encoder::InstructionEncoder::decode(byte_stream));
+    delete byte_stream;
+  }
+
+  leaders_.resize(instructions_.size(), false);
+  if (not leaders_.empty()) {
+    leaders_[0] = true;
+  }
+  for (int i = 0; i < num_instructions(); i++) {
+    abi::instruction::Instruction *instruction = instructions_[i];
+    if (not is_translatable(instruction) and i + 1 < num_instructions()) {
+      leaders_[i + 1] = true;
+    }
+
+    if (instruction->has_pc()) {
+      Address target = instruction->pc()->value();
+      if (target >= pc(0) and (target - pc(0)) % instruction_size == 0 and
+          (target - pc(0)) / instruction_size < num_instructions()) {
+        leaders_[(target - pc(0)) / instruction_size] = true;
+      }
+    }
+  }
+}
+
+BlockTranslator::~BlockTranslator() {
+  for (auto &instruction : instructions_) {
+    delete instruction;
+  }
+}
+
+int BlockTranslator::num_blocks() {
+  int num_blocks = 0;
+  for (int i = 0; i < num_instructions(); i++) {
+    if (leaders_[i] and is_translatable(instructions_[i])) {
+      num_blocks++;
+    }
+  }
+  return num_blocks;
+}
+
+int BlockTranslator::num_translated_instructions() {
+  int num_translated_instructions = 0;
+  for (auto &instruction : instructions_) {
+    if (is_translatable(instruction)) {
+      num_translated_instructions++;
+    }
+  }
+  return num_translated_instructions;
+}
+
+void BlockTranslator::write(std::ostream &os, std::string source) {
+  constexpr int num_regs =
+      util::ConfigLoader::num_gp_registers() + abi::reg::ID8 + 1;
+
+  os << "// Generated by uPIMulator --translate from " << source << "\n";
+  os << "// " << num_blocks() << " blocks, " << num_translated_instructions()
+     << " of " << num_instructions() << " instructions translated\n";
+  os << "//\n";
+  os << "// Build against the backend sources with the simulator's hardware "
+     << "profile and\n";
+  os << "// load with --translated_blocks, e.g.\n";
+  os << "//   g++ -std=c++20 -O2 -shared -fPIC -I <backend>/src <this file> "
+     << "<backend>/src/simulator/dpu/alu.cc "
+     << "<backend>/src/abi/word/_base_word.cc -o blocks.so\n";
+  os << "\n";
+  os << "#include <cstdint>\n";
+  os << "\n";
+  os << "#include \"simulator/dpu/alu.h\"\n";
+  os << "#include \"translator/translated_block.h\"\n";
+  os << "\n";
+  os << "static_assert(sizeof(upmem_translated_state::regs) / sizeof(uint32_t) "
+     << "== " << num_regs << ");\n";
+  os << "\n";
+  os << "namespace {\n";
+  os << "\n";
+  os << "using upmem_sim::simulator::dpu::ALU;\n";
+
+  for (int i = 0; i < num_instructions(); i++) {
+    if (leaders_[i] and is_translatable(instructions_[i])) {
+      write_block(os, i, block_end(i));
+    }
+  }
+
+  os << "\n";
+  os << "}  // namespace\n";
+  os << "\n";
+  os << "// nullptr when the interpreter has to run the instruction at pc\n";
+  os << "extern \"C\" upmem_translated_block upmem_translated_block_at(\n";
+  os << "    uint32_t pc) {\n";
+  os << "  switch (pc) {\n";
+  for (int i = 0; i < num_instructions(); i++) {
+    if (leaders_[i] and is_translatable(instructions_[i])) {
+      os << "    case " << pc(i) << ":\n";
+      os << "      return block_" << pc(i) << ";\n";
+    }
+  }
+  os << "    default:\n";
+  os << "      return nullptr;\n";
+  os << "  }\n";
+  os << "}\n";
+}
+
+bool BlockTranslator::is_translatable(
+    abi::instruction::Instruction *instruction) {
+  abi::instruction::OpCode op_code = instruction->op_code();
+  abi::instruction::Suffix suffix = instruction->suffix();
+  if (op_code == abi::instruction::CALL or op_code == abi::instruction::HASH or
+      op_code == abi::instruction::LSL1X or
+      op_code == abi::instruction::LSR1X) {
+    return false;
+  }
+
+  if (suffix == abi::instruction::RRI) {
+    return abi::instruction::Instruction::rri_op_codes().count(op_code);
+  } else if (suffix == abi::instruction::RRR) {
+    return abi::instruction::Instruction::rrr_op_codes().count(op_code);
+  } else {
+    return false;
+  }
+}
+
+std::string BlockTranslator::alu_function(abi::instruction::OpCode op_code) {
+  if (op_code == abi::instruction::AND or op_code == abi::instruction::OR or
+      op_code == abi::instruction::XOR) {
+    // the ALU spells these with a trailing underscore
+    return converter::OpCodeConverter::to_string(op_code) + "_";
+  } else if (op_code == abi::instruction::RSUB) {
+    return "sub";
+  } else if (op_code == abi::instruction::RSUBC) {
+    return "subc";
+  } else {
+    return converter::OpCodeConverter::to_string(op_code);
+  }
+}
+
+bool BlockTranslator::has_carry(abi::instruction::OpCode op_code) {
+  return op_code == abi::instruction::ADD or
+         op_code == abi::instruction::ADDC or
+         op_code == abi::instruction::SUB or
+         op_code == abi::instruction::SUBC or
+         op_code == abi::instruction::RSUB or
+         op_code == abi::instruction::RSUBC;
+}
+
+std::string BlockTranslator::reg(abi::reg::SrcReg *src_reg) {
+  // operands are read SIGNED, as Logic does for RRI and RRR
+  return "static_cast<int32_t>(state->regs[" +
+         std::to_string(src_reg->index()) + "])";
+}
+
+Address BlockTranslator::pc(int index) {
+  return util::ConfigLoader::iram_offset() +
+         index * util::ConfigLoader::iram_data_width() / 8;
+}
+
+int BlockTranslator::block_end(int index) {
+  int end = index + 1;
+  while (end < num_instructions() and not leaders_[end] and
+         is_translatable(instructions_[end])) {
+    end++;
+  }
+  return end;
+}
+
+void BlockTranslator::write_block(std::ostream &os, int begin, int end) {
+  os << "\n";
+  os << "void block_" << pc(begin)
+     << "(upmem_translated_state *state) {\n";
+  for (int i = begin; i < end; i++) {
+    write_instruction(os, instructions_[i]);
+  }
+  os << "  state->pc = " << pc(end) << ";\n";
+  os << "}\n";
+}
+
+void BlockTranslator::write_instruction(
+    std::ostream &os, abi::instruction::Instruction *instruction) {
+  abi::instruction::OpCode op_code = instruction->op_code();
+  std::string ra = reg(instruction->ra());
+  std::string operand2 = instruction->suffix() == abi::instruction::RRI
+                             ? std::to_string(instruction->imm()->value())
+                             : reg(instruction->rb());
+  if (op_code == abi::instruction::RSUB or op_code == abi::instruction::RSUBC) {
+    std::swap(ra, operand2);
+  }
+
+  std::string arguments = ra + ", " + operand2;
+  if (op_code == abi::instruction::ADDC or op_code == abi::instruction::SUBC or
+      op_code == abi::instruction::RSUBC) {
+    arguments += ", (state->flags >> " + std::to_string(abi::isa::CARRY) +
+                 ") & 1";
+  }
+
+  os << "  {  // " << converter::OpCodeConverter::to_string(op_code) << ", "
+     << converter::SuffixConverter::to_string(instruction->suffix()) << "\n";
+  if (has_carry(op_code)) {
+    os << "    auto [result, carry, overflow] = ALU::" << alu_function(op_code)
+       << "(" << arguments << ");\n";
+  } else {
+    os << "    int64_t result = ALU::" << alu_function(op_code) << "("
+       << arguments << ");\n";
+    os << "    bool carry = false;\n";
+  }
+  os << "    state->regs[" << instruction->rc()->index()
+     << "] = static_cast<uint32_t>(result);\n";
+  os << "    state->conditions = uint64_t{1} << " << abi::isa::TRUE << ";\n";
+  os << "    state->flags = (result == 0) << " << abi::isa::ZERO
+     << " | carry << " << abi::isa::CARRY << ";\n";
+  os << "  }\n";
+}
+
+}  // namespace upmem_sim::translator
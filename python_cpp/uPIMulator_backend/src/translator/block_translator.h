@@ -0,0 +1,49 @@
+#ifndef UPMEM_SIM_TRANSLATOR_BLOCK_TRANSLATOR_H_
+#define UPMEM_SIM_TRANSLATOR_BLOCK_TRANSLATOR_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "abi/instruction/instruction.h"
+#include "encoder/byte_stream.h"
+
+namespace upmem_sim::translator {
+
+// Translates an IRAM image into a C++ translation unit with one function per
+// basic block, built on the ALU. Only register-to-register arithmetic (RRI
+// and RRR without CALL or HASH) is translated; a block ends at the first other
+// instruction, which the generated code leaves to the interpreter by setting
+// the pc to it. Blocks also start at every pc target in the image. The
+// output builds into a library that --translated_blocks loads.
+class BlockTranslator {
+ public:
+  explicit BlockTranslator(encoder::ByteStream *iram_byte_stream);
+  ~BlockTranslator();
+
+  int num_instructions() { return static_cast<int>(instructions_.size()); }
+  int num_blocks();
+  int num_translated_instructions();
+
+  void write(std::ostream &os, std::string source);
+
+ protected:
+  static bool is_translatable(abi::instruction::Instruction *instruction);
+  static std::string alu_function(abi::instruction::OpCode op_code);
+  static bool has_carry(abi::instruction::OpCode op_code);
+  static std::string reg(abi::reg::SrcReg *src_reg);
+
+  Address pc(int index);
+  int block_end(int index);
+  void write_block(std::ostream &os, int begin, int end);
+  void write_instruction(std::ostream &os,
+                         abi::instruction::Instruction *instruction);
+
+ private:
+  std::vector<abi::instruction::Instruction *> instructions_;
+  std::vector<bool> leaders_;
+};
+
+}  // namespace upmem_sim::translator
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef UPMEM_SIM_TRANSLATOR_TRANSLATED_BLOCK_H_
+#define UPMEM_SIM_TRANSLATOR_TRANSLATED_BLOCK_H_
+
+#include <cstdint>
+
+#include "abi/reg/sp_reg.h"
+#include "util/config_loader.h"
+
+// ABI between the simulator and a library built from BlockTranslator output;
+// both sides include this header
+extern "C" {
+
+// regs holds the GP registers followed by the special registers, in RegFile
+// slot order; condition and flag bits follow abi::isa
+struct upmem_translated_state {
+  uint32_t regs[upmem_sim::util::ConfigLoader::num_gp_registers() +
+                upmem_sim::abi::reg::ID8 + 1];
+  uint32_t pc;
+  uint64_t conditions;
+  uint8_t flags;
+};
+
+typedef void (*upmem_translated_block)(upmem_translated_state *);
+typedef upmem_translated_block (*upmem_translated_block_lookup)(uint32_t pc);
+
+}
+
+#endif
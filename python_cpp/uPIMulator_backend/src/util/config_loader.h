@@ -2,39 +2,53 @@
 #define UPMEM_SIM_UTIL_CONFIG_LOADER_H_
 
 #include "main.h"
+#include "util/hardware_profile.h"
 
 namespace upmem_sim::util {
 
 class ConfigLoader {
  public:
-  static int atomic_address_width() { return 32; }
-  static int atomic_data_width() { return 32; }
-  static Address atomic_offset() { return 0; }
-  static Address atomic_size() { return 256; }
-
-  static int iram_address_width() { return 32; }
-  static int iram_data_width() { return 96; }
-  static Address iram_offset() { return 384 * 1024; }
-  static Address iram_size() { return 48 * 1024; }
-
-  static int wram_address_width() { return 32; }
-  static int wram_data_width() { return 32; }
-  static Address wram_offset() { return 512; }
-  static Address wram_size() { return 128 * 1024; }
-
-  static Address stack_size() { return 2 * 1024; }
-  static Address heap_size() { return 4 * 1024; }
-
-  static int mram_address_width() { return 32; }
-  static int mram_data_width() { return 32; }
-  static Address mram_offset() { return 512 * 1024; }
-  static Address mram_size() { return 64 * 1024 * 1024; }
-
-  static int num_gp_registers() { return 24; }
-  static int max_num_tasklets() { return 24; }
-  static int min_access_granularity() { return 8; }
+  static constexpr const HardwareProfile &profile() { return hardware_profile; }
+
+  static constexpr int atomic_address_width() { return 32; }
+  static constexpr int atomic_data_width() { return 32; }
+  static constexpr Address atomic_offset() { return 0; }
+  static constexpr Address atomic_size() { return 256; }
+
+  static constexpr int iram_address_width() { return 32; }
+  static constexpr int iram_data_width() { return 96; }
+  static constexpr Address iram_offset() { return 384 * 1024; }
+  static constexpr Address iram_size() { return profile().iram_size; }
+
+  static constexpr int wram_address_width() { return 32; }
+  static constexpr int wram_data_width() { return 32; }
+  static constexpr Address wram_offset() { return 512; }
+  static constexpr Address wram_size() { return profile().wram_size; }
+
+  static constexpr Address stack_size() { return 2 * 1024; }
+  static constexpr Address heap_size() { return 4 * 1024; }
+
+  static constexpr int mram_address_width() { return 32; }
+  static constexpr int mram_data_width() { return 32; }
+  static constexpr Address mram_offset() { return 512 * 1024; }
+  static constexpr Address mram_size() { return profile().mram_size; }
+
+  static constexpr int num_gp_registers() {
+    return profile().num_gp_registers;
+  }
+  static constexpr int max_num_tasklets() {
+    return profile().max_num_tasklets;
+  }
+  static constexpr int min_access_granularity() { return 8; }
 };
 
+static_assert(ConfigLoader::wram_offset() + ConfigLoader::wram_size() <=
+                  ConfigLoader::iram_offset(),
+              "WRAM overlaps IRAM");
+static_assert(ConfigLoader::iram_offset() + ConfigLoader::iram_size() <=
+                  ConfigLoader::mram_offset(),
+              "IRAM overlaps MRAM");
+
 }  // namespace upmem_sim::util
 
 #endif
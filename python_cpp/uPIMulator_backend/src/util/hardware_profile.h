@@ -0,0 +1,38 @@
+#ifndef UPMEM_SIM_UTIL_HARDWARE_PROFILE_H_
+#define UPMEM_SIM_UTIL_HARDWARE_PROFILE_H_
+
+#include "main.h"
+
+namespace upmem_sim::util {
+
+// Memory sizes and thread counts of a DPU part. The profile is fixed at build
+// time (cmake -DUPMEM_SIM_HARDWARE_PROFILE=<name>) so that ConfigLoader hands
+// out compile-time constants; word widths and the address map are part of
+// the ISA and stay in ConfigLoader.
+struct HardwareProfile {
+  const char *name;
+
+  Address iram_size;
+  Address wram_size;
+  Address mram_size;
+
+  int num_gp_registers;
+  int max_num_tasklets;
+};
+
+inline constexpr HardwareProfile upmem_v1b = {
+    "upmem_v1b", 48 * 1024, 128 * 1024, 64 * 1024 * 1024, 24, 24};
+
+// hypothetical part with a larger scratchpad and more hardware threads
+inline constexpr HardwareProfile wram256k_32_tasklets = {
+    "wram256k_32_tasklets", 48 * 1024, 256 * 1024, 64 * 1024 * 1024, 24, 32};
+
+#ifndef UPMEM_SIM_HARDWARE_PROFILE
+#define UPMEM_SIM_HARDWARE_PROFILE upmem_v1b
+#endif
+
+inline constexpr HardwareProfile hardware_profile = UPMEM_SIM_HARDWARE_PROFILE;
+
+}  // namespace upmem_sim::util
+
+#endif
@@ -0,0 +1,117 @@
+#include "util/host_profiler.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+
+namespace upmem_sim::util {
+
+HostProfiler::HostProfiler(int num_timers, int64_t interval)
+    : timers_(num_timers),
+      interval_(interval),
+      num_cycles_(0),
+      next_report_cycle_(interval) {
+  assert(interval_ >= 0);
+
+  first_ = sample(0);
+  last_ = first_;
+}
+
+std::string HostProfiler::name(Component component) {
+  if (component == SCHEDULER) {
+    return "scheduler";
+  } else if (component == LOGIC) {
+    return "logic";
+  } else if (component == DMA) {
+    return "dma";
+  } else if (component == MEMORY_CONTROLLER) {
+    return "memory_controller";
+  } else if (component == ROW_BUFFER) {
+    return "row_buffer";
+  } else {
+    throw std::invalid_argument("");
+  }
+}
+
+int64_t HostProfiler::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t HostProfiler::max_rss_kb() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+void HostProfiler::report_interval(std::ostream &os,
+                                   int64_t num_instructions) {
+  Sample current = sample(num_instructions);
+
+  os << "HostProfile@" << num_cycles_ << ":";
+  for (auto &[key, value] : metrics(last_, current)) {
+    os << " " << key << "=" << value;
+  }
+  os << std::endl;
+
+  last_ = current;
+}
+
+void HostProfiler::report(std::ostream &os, int64_t num_instructions) {
+  for (auto &[key, value] : metrics(first_, sample(num_instructions))) {
+    os << "HostProfile/" << key << ": " << value << std::endl;
+  }
+}
+
+HostProfiler::Sample HostProfiler::sample(int64_t num_instructions) {
+  Sample sample{now(), num_cycles_, 0, num_instructions, {}};
+  for (auto &timer : timers_) {
+    sample.num_dpu_cycles += timer.num_cycles();
+    for (int i = 0; i < NUM_COMPONENTS; i++) {
+      sample.ns[i] += timer.ns(static_cast<Component>(i));
+    }
+  }
+  return sample;
+}
+
+std::vector<std::pair<std::string, std::string>> HostProfiler::metrics(
+    const Sample &from, const Sample &to) {
+  auto format = [](double value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return std::string(buffer);
+  };
+
+  double seconds = static_cast<double>(to.time - from.time) / 1e9;
+  auto num_dpu_cycles = static_cast<double>(
+      std::max<int64_t>(to.num_dpu_cycles - from.num_dpu_cycles, 1));
+
+  std::vector<std::pair<std::string, std::string>> metrics;
+  metrics.emplace_back("wall_seconds", format(seconds));
+  metrics.emplace_back(
+      "cycles_per_second",
+      format(static_cast<double>(to.num_cycles - from.num_cycles) / seconds));
+  metrics.emplace_back(
+      "dpu_cycles_per_second",
+      format(static_cast<double>(to.num_dpu_cycles - from.num_dpu_cycles) /
+             seconds));
+  metrics.emplace_back(
+      "instructions_per_second",
+      format(static_cast<double>(to.num_instructions - from.num_instructions) /
+             seconds));
+  // host time per component, averaged over the simulated DPU cycles
+  for (int i = 0; i < NUM_COMPONENTS; i++) {
+    metrics.emplace_back(
+        name(static_cast<Component>(i)) + "_ns_per_cycle",
+        format(static_cast<double>(to.ns[i] - from.ns[i]) / num_dpu_cycles));
+  }
+  metrics.emplace_back("max_rss_kb", std::to_string(max_rss_kb()));
+  return metrics;
+}
+
+}  // namespace upmem_sim::util
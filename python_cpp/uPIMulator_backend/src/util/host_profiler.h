@@ -0,0 +1,95 @@
+#ifndef UPMEM_SIM_UTIL_HOST_PROFILER_H_
+#define UPMEM_SIM_UTIL_HOST_PROFILER_H_
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace upmem_sim::util {
+
+// Measures where the host spends its time while simulating. Each DPU owns a
+// Timer so that ranks stepped on different host threads never share one.
+class HostProfiler {
+ public:
+  enum Component {
+    SCHEDULER = 0,
+    LOGIC,
+    DMA,
+    MEMORY_CONTROLLER,
+    ROW_BUFFER,
+    NUM_COMPONENTS
+  };
+
+  class Timer {
+   public:
+    void start() {
+      last_ = now();
+      num_cycles_ += 1;
+    }
+    void lap(Component component) {
+      int64_t time = now();
+      ns_[component] += time - last_;
+      last_ = time;
+    }
+
+    int64_t num_cycles() { return num_cycles_; }
+    int64_t ns(Component component) { return ns_[component]; }
+
+   private:
+    int64_t last_ = 0;
+    int64_t num_cycles_ = 0;
+    std::array<int64_t, NUM_COMPONENTS> ns_{};
+  };
+
+  explicit HostProfiler(int num_timers, int64_t interval);
+  ~HostProfiler() = default;
+
+  static std::string name(Component component);
+  static int64_t now();
+  static int64_t max_rss_kb();
+
+  Timer *timer(int index) { return &timers_[index]; }
+
+  // advances to the given simulated cycle; true when an interval report is
+  // due, at most once per call however many intervals the cycle skipped
+  bool cycle(int64_t cycle) {
+    num_cycles_ = cycle;
+    if (interval_ == 0 or num_cycles_ < next_report_cycle_) {
+      return false;
+    }
+    next_report_cycle_ = (num_cycles_ / interval_ + 1) * interval_;
+    return true;
+  }
+
+  void report_interval(std::ostream &os, int64_t num_instructions);
+  void report(std::ostream &os, int64_t num_instructions);
+
+ protected:
+  struct Sample {
+    int64_t time;
+    int64_t num_cycles;
+    int64_t num_dpu_cycles;
+    int64_t num_instructions;
+    std::array<int64_t, NUM_COMPONENTS> ns;
+  };
+
+  Sample sample(int64_t num_instructions);
+  std::vector<std::pair<std::string, std::string>> metrics(const Sample &from,
+                                                           const Sample &to);
+
+ private:
+  std::vector<Timer> timers_;
+  int64_t interval_;
+  int64_t num_cycles_;
+  int64_t next_report_cycle_;
+
+  Sample first_;
+  Sample last_;
+};
+
+}  // namespace upmem_sim::util
+
+#endif
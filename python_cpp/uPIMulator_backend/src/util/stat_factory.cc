@@ -25,12 +25,10 @@ void StatFactory::overwrite(std::string stat, int64_t value) {
 }
 
 void StatFactory::merge(StatFactory *stat_factory) {
+  // build each key once; operator[] value-initializes new stats to 0
+  std::string prefix = stat_factory->name() + "/";
   for (auto &[stat, value] : stat_factory->stats_) {
-    if (stats_.count(stat_factory->name() + "/" + stat)) {
-      stats_[stat_factory->name() + "/" + stat] += value;
-    } else {
-      stats_[stat_factory->name() + "/" + stat] = value;
-    }
+    stats_[prefix + stat] += value;
   }
 }
 
@@ -15,6 +15,7 @@ class StatFactory {
   std::string name() { return name_; }
 
   std::set<std::string> stats();
+  const std::map<std::string, int64_t> &values() { return stats_; }
   int64_t value(std::string stat) { return stats_[stat]; }
 
   void increment(std::string stat) { increment(stat, 1); }
@@ -0,0 +1,32 @@
+#include "util/stat_series.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace upmem_sim::util {
+
+StatSeries::StatSeries(std::string filepath, int64_t interval)
+    : ofs_(filepath),
+      interval_(interval),
+      num_cycles_(0),
+      next_record_cycle_(interval) {
+  assert(interval_ > 0);
+
+  if (not ofs_) {
+    throw std::invalid_argument("");
+  }
+  ofs_ << "cycle,stat,delta\n";
+}
+
+void StatSeries::record(StatFactory *stat_factory) {
+  for (auto &stat : stat_factory->stats()) {
+    int64_t value = stat_factory->value(stat);
+    int64_t &last_value = last_values_[stat];
+    if (value != last_value) {
+      ofs_ << num_cycles_ << "," << stat << "," << value - last_value << "\n";
+      last_value = value;
+    }
+  }
+}
+
+}  // namespace upmem_sim::util
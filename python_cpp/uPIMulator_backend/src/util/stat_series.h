@@ -0,0 +1,46 @@
+#ifndef UPMEM_SIM_UTIL_STAT_SERIES_H_
+#define UPMEM_SIM_UTIL_STAT_SERIES_H_
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "util/stat_factory.h"
+
+namespace upmem_sim::util {
+
+// Time series of every stat as CSV rows "cycle,stat,delta", where cycle is
+// the simulated end-to-end cycle of the snapshot. Only stats that changed
+// since the previous snapshot get a row, so summing the deltas of a stat up
+// to some cycle gives its value at that cycle.
+class StatSeries {
+ public:
+  explicit StatSeries(std::string filepath, int64_t interval);
+  ~StatSeries() = default;
+
+  // advances to the given simulated cycle; true when a snapshot is due, at
+  // most once per call however many intervals the cycle skipped
+  bool cycle(int64_t cycle) {
+    num_cycles_ = cycle;
+    if (num_cycles_ < next_record_cycle_) {
+      return false;
+    }
+    next_record_cycle_ = (num_cycles_ / interval_ + 1) * interval_;
+    return true;
+  }
+
+  void record(StatFactory *stat_factory);
+
+ private:
+  std::ofstream ofs_;
+  int64_t interval_;
+  int64_t num_cycles_;
+  int64_t next_record_cycle_;
+
+  std::map<std::string, int64_t> last_values_;
+};
+
+}  // namespace upmem_sim::util
+
+#endif
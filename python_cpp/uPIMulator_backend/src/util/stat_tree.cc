@@ -0,0 +1,189 @@
+#include "util/stat_tree.h"
+
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+
+namespace upmem_sim::util {
+
+StatTree::StatTree(StatFactory *stat_factory) : name_(stat_factory->name()) {
+  std::map<int, StatTree *> tasklets;
+  for (auto &[stat, value] : stat_factory->values()) {
+    size_t underscore_pos = stat.find('_');
+    bool is_tasklet_stat =
+        underscore_pos != 0 and underscore_pos != std::string::npos;
+    for (size_t i = 0; is_tasklet_stat and i < underscore_pos; i++) {
+      is_tasklet_stat = std::isdigit(static_cast<unsigned char>(stat[i]));
+    }
+
+    if (is_tasklet_stat) {
+      int tasklet = std::stoi(stat.substr(0, underscore_pos));
+      StatTree *&tasklet_tree = tasklets[tasklet];
+      if (tasklet_tree == nullptr) {
+        tasklet_tree = new StatTree("tasklet#" + std::to_string(tasklet));
+      }
+      tasklet_tree->stats_.emplace_back(stat.substr(underscore_pos + 1), value);
+    } else {
+      stats_.emplace_back(stat, value);
+    }
+  }
+
+  for (auto &[tasklet, tasklet_tree] : tasklets) {
+    add_child(tasklet_tree);
+  }
+}
+
+StatTree::~StatTree() {
+  for (auto &child : children_) {
+    delete child;
+  }
+}
+
+void StatTree::aggregate(std::string path, bool in_dpu,
+                         Aggregates &aggregates) {
+  if (in_dpu) {
+    for (auto &[stat, value] : stats_) {
+      Aggregate &aggregate = aggregates[path + stat];
+      aggregate.sum += value;
+      aggregate.max = std::max(aggregate.max, value);
+      aggregate.min = std::min(aggregate.min, value);
+      aggregate.count += 1;
+    }
+  }
+
+  for (auto &child : children_) {
+    if (child->name_.rfind("DPU#", 0) == 0) {
+      child->aggregate("", true, aggregates);
+    } else if (in_dpu) {
+      child->aggregate(path + child->name_ + "/", true, aggregates);
+    } else {
+      child->aggregate("", false, aggregates);
+    }
+  }
+}
+
+void StatTree::write_json(std::ostream &os) {
+  Aggregates aggregates;
+  aggregate("", false, aggregates);
+
+  os << "{\n  \"tree\": ";
+  write_json(os, 1);
+  os << ",\n  \"dpu_aggregate\": {";
+  bool is_first = true;
+  for (auto &[stat, aggregate] : aggregates) {
+    os << (is_first ? "\n" : ",\n") << "    \"" << stat << "\": {\"sum\": "
+       << aggregate.sum << ", \"mean\": " << aggregate.mean()
+       << ", \"max\": " << aggregate.max << ", \"min\": " << aggregate.min
+       << "}";
+    is_first = false;
+  }
+  os << "\n  }\n}\n";
+}
+
+void StatTree::write_json(std::ostream &os, int depth) {
+  std::string indent(2 * depth, ' ');
+
+  os << "{\n" << indent << "  \"name\": \"" << name_ << "\",\n";
+  os << indent << "  \"stats\": {";
+  for (int i = 0; i < static_cast<int>(stats_.size()); i++) {
+    os << (i == 0 ? "" : ", ") << "\"" << stats_[i].first
+       << "\": " << stats_[i].second;
+  }
+  os << "},\n" << indent << "  \"children\": [";
+  for (int i = 0; i < static_cast<int>(children_.size()); i++) {
+    os << (i == 0 ? "" : ", ");
+    children_[i]->write_json(os, depth + 1);
+  }
+  os << "]\n" << indent << "}";
+}
+
+void StatTree::write_csv(std::ostream &os) {
+  os << "view,path,stat,value\n";
+  write_csv(os, "");
+
+  Aggregates aggregates;
+  aggregate("", false, aggregates);
+  for (auto &[stat, aggregate] : aggregates) {
+    size_t slash_pos = stat.rfind('/');
+    std::string path =
+        "DPU" + (slash_pos == std::string::npos
+                     ? std::string()
+                     : "/" + stat.substr(0, slash_pos));
+    std::string name =
+        slash_pos == std::string::npos ? stat : stat.substr(slash_pos + 1);
+
+    os << "sum," << path << "," << name << "," << aggregate.sum << "\n";
+    os << "mean," << path << "," << name << "," << aggregate.mean() << "\n";
+    os << "max," << path << "," << name << "," << aggregate.max << "\n";
+    os << "min," << path << "," << name << "," << aggregate.min << "\n";
+  }
+}
+
+void StatTree::write_csv(std::ostream &os, std::string path) {
+  path += name_;
+  for (auto &[stat, value] : stats_) {
+    os << "value," << path << "," << stat << "," << value << "\n";
+  }
+  for (auto &child : children_) {
+    child->write_csv(os, path + "/");
+  }
+}
+
+void StatTree::write_binary(std::ostream &os) {
+  std::vector<std::pair<std::string, std::string>> names;
+  std::vector<int64_t> values;
+  collect("", names, values);
+
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, uint32_t> string_ids;
+  auto intern = [&strings, &string_ids](const std::string &string) {
+    auto [it, inserted] = string_ids.try_emplace(
+        string, static_cast<uint32_t>(strings.size()));
+    if (inserted) {
+      strings.push_back(string);
+    }
+    return it->second;
+  };
+
+  std::vector<uint32_t> path_ids;
+  std::vector<uint32_t> stat_ids;
+  for (auto &[path, stat] : names) {
+    path_ids.push_back(intern(path));
+    stat_ids.push_back(intern(stat));
+  }
+
+  auto write_u32 = [&os](uint32_t value) {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+
+  os.write("UPMS", 4);
+  write_u32(binary_version);
+  write_u32(static_cast<uint32_t>(strings.size()));
+  for (auto &string : strings) {
+    write_u32(static_cast<uint32_t>(string.size()));
+    os.write(string.data(), string.size());
+  }
+
+  write_u32(static_cast<uint32_t>(values.size()));
+  os.write(reinterpret_cast<const char *>(path_ids.data()),
+           path_ids.size() * sizeof(uint32_t));
+  os.write(reinterpret_cast<const char *>(stat_ids.data()),
+           stat_ids.size() * sizeof(uint32_t));
+  os.write(reinterpret_cast<const char *>(values.data()),
+           values.size() * sizeof(int64_t));
+}
+
+void StatTree::collect(
+    std::string path, std::vector<std::pair<std::string, std::string>> &names,
+    std::vector<int64_t> &values) {
+  path += name_;
+  for (auto &[stat, value] : stats_) {
+    names.emplace_back(path, stat);
+    values.push_back(value);
+  }
+  for (auto &child : children_) {
+    child->collect(path + "/", names, values);
+  }
+}
+
+}  // namespace upmem_sim::util
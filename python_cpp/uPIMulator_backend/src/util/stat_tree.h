@@ -0,0 +1,66 @@
+#ifndef UPMEM_SIM_UTIL_STAT_TREE_H_
+#define UPMEM_SIM_UTIL_STAT_TREE_H_
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/stat_factory.h"
+
+namespace upmem_sim::util {
+
+// Stats kept per component instance (system/rank/DPU/component/tasklet)
+// rather than merged into flat "a/b/stat" keys, which also sums every DPU
+// into one value. Stats named "<tasklet>_<stat>" become tasklet#N children.
+class StatTree {
+ public:
+  explicit StatTree(StatFactory *stat_factory);
+  explicit StatTree(std::string name) : name_(name) {}
+  ~StatTree();
+
+  std::string name() { return name_; }
+
+  void add_child(StatTree *child) { children_.push_back(child); }
+
+  // the tree followed by sum, mean, max and min across DPUs
+  void write_json(std::ostream &os);
+  // view,path,stat,value rows; view is value, sum, mean, max or min
+  void write_csv(std::ostream &os);
+  // "UPMS", version, then a string table and the columns path id, stat id and
+  // value of every stat; views are left to the reader
+  void write_binary(std::ostream &os);
+
+ protected:
+  struct Aggregate {
+    int64_t sum = 0;
+    int64_t max = INT64_MIN;
+    int64_t min = INT64_MAX;
+    int64_t count = 0;
+
+    double mean() { return static_cast<double>(sum) / count; }
+  };
+
+  static constexpr uint32_t binary_version = 1;
+
+  // keyed by "<path below the DPU>/<stat>"
+  using Aggregates = std::map<std::string, Aggregate>;
+  void aggregate(std::string path, bool in_dpu, Aggregates &aggregates);
+
+  void write_json(std::ostream &os, int depth);
+  void write_csv(std::ostream &os, std::string path);
+  void collect(std::string path,
+               std::vector<std::pair<std::string, std::string>> &names,
+               std::vector<int64_t> &values);
+
+ private:
+  std::string name_;
+  std::vector<std::pair<std::string, int64_t>> stats_;
+  std::vector<StatTree *> children_;
+};
+
+}  // namespace upmem_sim::util
+
+#endif
@@ -1,4 +1,5 @@
 import os
+import struct
 from typing import List, Set, Union
 
 from abi.binary.executable import Executable
@@ -60,11 +61,9 @@ class Assembler:
         num_tasklets = Assembler._num_tasklets(executable)
         data_prep = Assembler.data_prep(benchmark, num_tasklets, data_prep_param, num_dpus)
 
-        Assembler._assemble_input_dpu_mram_heap_pointer_name(executable, data_prep)
-        Assembler._assemble_output_dpu_mram_heap_pointer_name(executable, data_prep)
-        Assembler._assemble_dpu_input_arguments(executable, data_prep)
-        Assembler._assemble_dpu_results(executable, data_prep)
+        Assembler._assemble_payloads(executable, data_prep)
         Assembler._assemble_num_executions(executable, data_prep)
+        Assembler._assemble_host_commands(executable, data_prep)
 
     @staticmethod
     def _assemble_atomic(executable: Executable, num_dpus: int) -> None:
@@ -213,74 +212,47 @@ class Assembler:
             file.writelines(lines)
 
     @staticmethod
-    def _assemble_input_dpu_mram_heap_pointer_name(executable: Executable, data_prep: DataPrep) -> None:
-        benchmark = Assembler._benchmark(executable)
-        num_tasklets = Assembler._num_tasklets(executable)
-
-        for execution in range(data_prep.num_executions()):
-            for dpu_id in range(data_prep.num_dpus()):
-                input_dpu_mram_heap_pointer_name = data_prep.input_dpu_mram_heap_pointer_name(execution, dpu_id)
-                if input_dpu_mram_heap_pointer_name is not None:
-                    input_dpu_mram_heap_pointer_name_filepath = os.path.join(
-                        PathCollector.bin_path_in_local(),
-                        f"{data_prep.num_dpus()}_dpus",
-                        f"{benchmark}.{num_tasklets}",
-                        f"input_dpu_mram_heap_pointer_name.dpu_id{dpu_id}.{execution}.bin",
-                    )
-                    input_dpu_mram_heap_pointer_name.dump(input_dpu_mram_heap_pointer_name_filepath)
-
-    @staticmethod
-    def _assemble_output_dpu_mram_heap_pointer_name(executable: Executable, data_prep: DataPrep) -> None:
-        benchmark = Assembler._benchmark(executable)
-        num_tasklets = Assembler._num_tasklets(executable)
-
-        for execution in range(data_prep.num_executions()):
-            for dpu_id in range(data_prep.num_dpus()):
-                output_dpu_mram_heap_pointer_name = data_prep.output_dpu_mram_heap_pointer_name(execution, dpu_id)
-                if output_dpu_mram_heap_pointer_name is not None:
-                    output_dpu_mram_heap_pointer_name_filepath = os.path.join(
-                        PathCollector.bin_path_in_local(),
-                        f"{data_prep.num_dpus()}_dpus",
-                        f"{benchmark}.{num_tasklets}",
-                        f"output_dpu_mram_heap_pointer_name.dpu_id{dpu_id}.{execution}.bin",
-                    )
-                    output_dpu_mram_heap_pointer_name.dump(output_dpu_mram_heap_pointer_name_filepath)
-
-    @staticmethod
-    def _assemble_dpu_input_arguments(executable: Executable, data_prep: DataPrep) -> None:
-        benchmark = Assembler._benchmark(executable)
-        num_tasklets = Assembler._num_tasklets(executable)
-
-        for execution in range(data_prep.num_executions()):
-            for dpu_id in range(data_prep.num_dpus()):
-                dpu_input_arguments = data_prep.dpu_input_arguments(execution, dpu_id)
-                if dpu_input_arguments is not None:
-                    dpu_input_arguments_filepath = os.path.join(
-                        PathCollector.bin_path_in_local(),
-                        f"{data_prep.num_dpus()}_dpus",
-                        f"{benchmark}.{num_tasklets}",
-                        f"dpu_input_arguments.dpu_id{dpu_id}.{execution}.bin",
-                    )
-
-                    dpu_input_arguments.dump(dpu_input_arguments_filepath)
-
-    @staticmethod
-    def _assemble_dpu_results(executable: Executable, data_prep: DataPrep) -> None:
+    def _assemble_payloads(executable: Executable, data_prep: DataPrep) -> None:
         benchmark = Assembler._benchmark(executable)
         num_tasklets = Assembler._num_tasklets(executable)
+        payloads_filepath = os.path.join(
+            PathCollector.bin_path_in_local(),
+            f"{data_prep.num_dpus()}_dpus",
+            f"{benchmark}.{num_tasklets}",
+            "payloads.bin",
+        )
 
+        # (execution, dpu_id, kind) order must match the backend's PayloadArchive index
+        kinds = [
+            data_prep.input_dpu_mram_heap_pointer_name,
+            data_prep.output_dpu_mram_heap_pointer_name,
+            data_prep.dpu_input_arguments,
+            data_prep.dpu_results,
+        ]
+        num_entries = data_prep.num_executions() * data_prep.num_dpus() * len(kinds)
+
+        index = []
+        payloads = []
+        offset = 24 + 16 * num_entries
         for execution in range(data_prep.num_executions()):
             for dpu_id in range(data_prep.num_dpus()):
-                dpu_results = data_prep.dpu_results(execution, dpu_id)
-                if dpu_results is not None:
-                    dpu_results_filepath = os.path.join(
-                        PathCollector.bin_path_in_local(),
-                        f"{data_prep.num_dpus()}_dpus",
-                        f"{benchmark}.{num_tasklets}",
-                        f"dpu_results.dpu_id{dpu_id}.{execution}.bin",
-                    )
-
-                    dpu_results.dump(dpu_results_filepath)
+                for kind in kinds:
+                    payload = kind(execution, dpu_id)
+                    if payload is not None:
+                        encoded = payload.encode()
+                        index.append((offset, len(encoded)))
+                        payloads.append(encoded)
+                        offset += len(encoded)
+                    else:
+                        index.append((0, 0))
+
+        with open(payloads_filepath, "wb") as file:
+            file.write(b"UPMP")
+            file.write(struct.pack("<5I", 1, data_prep.num_dpus(), data_prep.num_executions(), len(kinds), 0))
+            for entry in index:
+                file.write(struct.pack("<2Q", *entry))
+            for payload in payloads:
+                file.write(payload)
 
     @staticmethod
     def _assemble_labels(executable: Executable, num_dpus: int) -> None:
@@ -312,6 +284,37 @@ class Assembler:
             lines = f"{data_prep.num_executions()}\n"
             file.writelines(lines)
 
+    @staticmethod
+    def _assemble_host_commands(executable: Executable, data_prep: DataPrep) -> None:
+        benchmark = Assembler._benchmark(executable)
+        num_tasklets = Assembler._num_tasklets(executable)
+        host_commands_filepath = os.path.join(
+            PathCollector.bin_path_in_local(),
+            f"{data_prep.num_dpus()}_dpus",
+            f"{benchmark}.{num_tasklets}",
+            "host_commands.bin",
+        )
+        with open(host_commands_filepath, "w") as file:
+            # TRNS rewrites its program image, so it is reloaded before every execution
+            reload = benchmark == "TRNS"
+
+            lines = ""
+            if not reload:
+                lines += "load *\n"
+            lines += f"loop e {data_prep.num_executions()}\n"
+            if reload:
+                lines += "load *\n"
+            lines += "xfer_to mram * @sys_used_mram_end payload:input_dpu_mram_heap_pointer_name:$e\n"
+            lines += "xfer_to wram * @dpu_input_arguments payload:dpu_input_arguments:$e\n"
+            lines += "launch *\n"
+            lines += "wait *\n"
+            lines += "xfer_from mram * @sys_used_mram_end payload:output_dpu_mram_heap_pointer_name:$e\n"
+            lines += "compare mram * @sys_used_mram_end payload:output_dpu_mram_heap_pointer_name:$e\n"
+            lines += "xfer_from wram * @dpu_results payload:dpu_results:$e\n"
+            lines += "compare wram * @dpu_results payload:dpu_results:$e\n"
+            lines += "end\n"
+            file.writelines(lines)
+
     @staticmethod
     def data_prep(benchmark: str, num_tasklets: int, data_prep_param: List[int], num_dpus: int) -> DataPrep:
         if benchmark == "BS":
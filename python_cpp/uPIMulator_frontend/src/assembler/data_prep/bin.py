@@ -13,3 +13,6 @@ class Bin:
             for byte in self._bytes:
                 lines += f"{byte.value()}\n"
             file.writelines(lines)
+
+    def encode(self) -> bytes:
+        return bytes(byte.value() for byte in self._bytes)
@@ -1,6 +1,7 @@
 #include "basic/instruction_parser.h"
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <iostream>
 
@@ -33,6 +34,40 @@ abi::instruction::Suffix InstructionParser::parse_suffix(std::string line) {
   return converter::SuffixConverter::to_suffix(suffix);
 }
 
+bool InstructionParser::parse_instruction(std::string_view line, upmem_sim::tracer::TraceRecord &record) {
+  size_t open_bracket_pos = line.find('[');
+  size_t close_bracket_pos = line.find(']');
+  if (open_bracket_pos == std::string_view::npos or close_bracket_pos == std::string_view::npos or
+      close_bracket_pos < open_bracket_pos) {
+    return false;
+  }
+
+  auto to_int = [](std::string_view token) {
+    int value = 0;
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value;
+  };
+
+  record = {};
+  if (line.front() == '{') {
+    record.dpu_id = to_int(line.substr(1, line.find('}') - 1));
+  }
+  record.thread_id = to_int(line.substr(open_bracket_pos + 1, close_bracket_pos - open_bracket_pos - 1));
+
+  auto next_token = [](std::string_view &text) {
+    text.remove_prefix(std::min(text.find_first_not_of(' '), text.size()));
+    size_t comma_pos = text.find(',');
+    std::string_view token = text.substr(0, comma_pos);
+    text.remove_prefix(comma_pos == std::string_view::npos ? text.size() : comma_pos + 1);
+    return token;
+  };
+
+  std::string_view operands = line.substr(close_bracket_pos + 1);
+  record.op_code = converter::OpCodeConverter::to_op_code(next_token(operands));
+  record.suffix = converter::SuffixConverter::to_suffix(next_token(operands));
+  return true;
+}
+
 std::tuple<ThreadID, Address> InstructionParser::parse_call_rri_instruction(std::string line, RegFile reg_file) {
   ThreadID thread_id = parse_thread_id(line);
 
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -10,6 +11,7 @@
 #include "abi/instruction/suffix.h"
 #include "basic/reg_file_parser.h"
 #include "main.h"
+#include "tracer/trace_record.h"
 
 namespace upmem_profiler::basic {
 
@@ -19,6 +21,9 @@ public:
   static abi::instruction::OpCode parse_op_code(std::string line);
   static abi::instruction::Suffix parse_suffix(std::string line);
 
+  // parses "{dpu}[thread] op_code, suffix, ..." without copying; false if the line is not an instruction
+  static bool parse_instruction(std::string_view line, upmem_sim::tracer::TraceRecord &record);
+
   static bool is_instruction(std::string line) {
     return line.find("[") != std::string::npos and line.find("]") != std::string::npos;
   }
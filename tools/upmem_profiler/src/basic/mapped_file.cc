@@ -0,0 +1,43 @@
+#include "basic/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+
+namespace upmem_profiler::basic {
+
+MappedFile::MappedFile(std::string filepath) : data_(nullptr), size_(0) {
+  int fd = open(filepath.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::invalid_argument("");
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    throw std::runtime_error("");
+  }
+  size_ = st.st_size;
+
+  if (size_ > 0) {
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("");
+    }
+    madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char *>(data);
+  }
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    munmap(const_cast<char *>(data_), size_);
+  }
+}
+
+} // namespace upmem_profiler::basic
@@ -0,0 +1,30 @@
+#ifndef UPMEM_PROFILER_BASIC_MAPPED_FILE_H_
+#define UPMEM_PROFILER_BASIC_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace upmem_profiler::basic {
+
+// read-only mmap of a whole file
+class MappedFile {
+public:
+  explicit MappedFile(std::string filepath);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  const char *data() { return data_; }
+  size_t size() { return size_; }
+  std::string_view view() { return {data_, size_}; }
+
+private:
+  const char *data_;
+  size_t size_;
+};
+
+} // namespace upmem_profiler::basic
+
+#endif
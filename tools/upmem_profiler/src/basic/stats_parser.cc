@@ -1,5 +1,6 @@
 #include "basic/stats_parser.h"
 
+#include <charconv>
 #include <fstream>
 #include <vector>
 
@@ -8,40 +9,37 @@ namespace upmem_profiler::basic {
 Stats StatsParser::parse(std::ifstream &ifs) {
   Stats stats;
 
-  while (true) {
-    std::string line;
-    std::getline(ifs, line);
-
-    if (line == "") {
-      break;
-    }
-
-    std::vector<std::string> tokens = split_by_colon(line);
+  std::string line;
+  while (std::getline(ifs, line) and line != "") {
+    std::vector<std::string_view> tokens = split_by_colon(line);
 
     if (tokens.size() == 2) {
-      std::string stat = tokens[0];
-      int64_t value = std::stoi(tokens[1]);
+      int64_t value = 0;
+      std::from_chars(tokens[1].data(), tokens[1].data() + tokens[1].size(), value);
 
-      stats[stat] = value;
+      stats[std::string(tokens[0])] = value;
     }
   }
 
   return std::move(stats);
 }
 
-std::vector<std::string> StatsParser::split_by_colon(std::string line) {
-  std::vector<std::string> tokens;
-  int pos;
-  while ((pos = line.find(":")) != std::string::npos) {
-    std::string token = line.substr(0, pos);
+std::vector<std::string_view> StatsParser::split_by_colon(std::string_view line) {
+  std::vector<std::string_view> tokens;
+  size_t pos;
+  while ((pos = line.find(":")) != std::string_view::npos) {
+    std::string_view token = line.substr(0, pos);
 
     if (token.substr(0, 1) == " ") {
-      token = token.substr(1);
+      token.remove_prefix(1);
     }
 
-    line.erase(0, pos + 1);
+    line.remove_prefix(pos + 1);
     tokens.push_back(token);
   }
+  if (line.substr(0, 1) == " ") {
+    line.remove_prefix(1);
+  }
   tokens.push_back(line);
   return std::move(tokens);
 }
@@ -4,6 +4,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace upmem_profiler::basic {
@@ -15,7 +16,7 @@ public:
   static Stats parse(std::ifstream &ifs);
 
 protected:
-  static std::vector<std::string> split_by_colon(std::string line);
+  static std::vector<std::string_view> split_by_colon(std::string_view line);
 
 private:
   std::set<std::string> stats_;
@@ -0,0 +1,43 @@
+#include "basic/symbol_table.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "util/config_loader.h"
+
+namespace upmem_profiler::basic {
+
+SymbolTable::SymbolTable(std::string filepath) {
+  std::ifstream ifs(filepath);
+
+  std::string line;
+  while (std::getline(ifs, line)) {
+    size_t colon_pos = line.rfind(':');
+    if (colon_pos == std::string::npos) {
+      continue;
+    }
+
+    std::string name = line.substr(0, colon_pos);
+    Address address;
+    if (name.empty() or name[0] == '.' or not(std::istringstream(line.substr(colon_pos + 1)) >> address)) {
+      continue;
+    }
+
+    if (util::ConfigLoader::iram_offset() <= address and
+        address < util::ConfigLoader::iram_offset() + util::ConfigLoader::iram_size()) {
+      symbols_.emplace(address, name);
+    }
+  }
+}
+
+std::string SymbolTable::lookup(Address pc) {
+  auto it = symbols_.upper_bound(pc);
+  if (it == symbols_.begin()) {
+    std::ostringstream oss;
+    oss << "0x" << std::hex << pc;
+    return oss.str();
+  }
+  return std::prev(it)->second;
+}
+
+} // namespace upmem_profiler::basic
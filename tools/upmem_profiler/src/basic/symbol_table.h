@@ -0,0 +1,26 @@
+#ifndef UPMEM_PROFILER_BASIC_SYMBOL_TABLE_H_
+#define UPMEM_PROFILER_BASIC_SYMBOL_TABLE_H_
+
+#include <map>
+#include <string>
+
+#include "main.h"
+
+namespace upmem_profiler::basic {
+
+// Maps IRAM addresses to the enclosing label of labels.bin ("name: address" per line). Local labels (".L...") are
+// skipped so that PCs resolve to their function.
+class SymbolTable {
+public:
+  explicit SymbolTable(std::string filepath);
+  ~SymbolTable() = default;
+
+  std::string lookup(Address pc);
+
+private:
+  std::map<Address, std::string> symbols_;
+};
+
+} // namespace upmem_profiler::basic
+
+#endif
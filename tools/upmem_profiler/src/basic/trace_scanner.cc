@@ -0,0 +1,88 @@
+#include "basic/trace_scanner.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "basic/instruction_parser.h"
+#include "tracer/trace_reader.h"
+
+namespace upmem_profiler::basic {
+
+TraceScanner::TraceScanner(std::string filepath, int num_threads)
+    : file_(filepath), is_binary_(upmem_sim::tracer::TraceReader::is_trace(filepath)), num_threads_(num_threads) {
+  if (num_threads_ <= 0) {
+    num_threads_ = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  if (is_binary_) {
+    index_binary();
+  } else {
+    index_text();
+  }
+}
+
+void TraceScanner::index_text() {
+  std::string_view text = file_.view();
+
+  size_t begin = 0;
+  while (begin < text.size()) {
+    size_t end = std::min(begin + text_chunk_size_, text.size());
+    if (end < text.size()) {
+      size_t newline = text.find('\n', end);
+      end = newline == std::string_view::npos ? text.size() : newline + 1;
+    }
+
+    chunks_.push_back({begin, end, 0});
+    begin = end;
+  }
+}
+
+void TraceScanner::index_binary() {
+  upmem_sim::tracer::TraceHeader header;
+  if (file_.size() < sizeof(header)) {
+    throw std::invalid_argument("");
+  }
+  std::memcpy(&header, file_.data(), sizeof(header));
+  if (header.version != upmem_sim::tracer::trace_version or header.record_size != sizeof(TraceRecord)) {
+    throw std::invalid_argument("");
+  }
+
+  size_t offset = sizeof(header);
+  while (offset + 2 * sizeof(uint32_t) <= file_.size()) {
+    uint32_t block_header[2];
+    std::memcpy(block_header, file_.data() + offset, sizeof(block_header));
+    offset += sizeof(block_header);
+
+    if (offset + block_header[1] > file_.size()) {
+      throw std::runtime_error("");
+    }
+
+    chunks_.push_back({offset, offset + block_header[1], block_header[0]});
+    offset += block_header[1];
+  }
+}
+
+void TraceScanner::parse_chunk(const Chunk &chunk, std::vector<TraceRecord> &records) {
+  if (is_binary_) {
+    upmem_sim::tracer::TraceReader::decode_block(file_.data() + chunk.begin, chunk.end - chunk.begin,
+                                                 chunk.num_records, records);
+    return;
+  }
+
+  records.clear();
+
+  std::string_view text = file_.view().substr(chunk.begin, chunk.end - chunk.begin);
+  while (not text.empty()) {
+    size_t newline = text.find('\n');
+    std::string_view line = text.substr(0, newline);
+    text.remove_prefix(newline == std::string_view::npos ? text.size() : newline + 1);
+
+    TraceRecord record;
+    if (InstructionParser::parse_instruction(line, record)) {
+      records.push_back(record);
+    }
+  }
+}
+
+} // namespace upmem_profiler::basic
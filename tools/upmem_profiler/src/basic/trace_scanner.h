@@ -0,0 +1,73 @@
+#ifndef UPMEM_PROFILER_BASIC_TRACE_SCANNER_H_
+#define UPMEM_PROFILER_BASIC_TRACE_SCANNER_H_
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "basic/mapped_file.h"
+#include "tracer/trace_record.h"
+
+namespace upmem_profiler::basic {
+
+using TraceRecord = upmem_sim::tracer::TraceRecord;
+
+// Splits a text log or a binary trace into chunks at record boundaries and parses the chunks on worker threads.
+// Each worker folds records into its own partial and the caller merges the partials afterwards. Records parsed from
+// text logs only carry dpu_id, thread_id, op_code and suffix.
+class TraceScanner {
+public:
+  explicit TraceScanner(std::string filepath, int num_threads);
+  ~TraceScanner() = default;
+
+  bool is_binary() { return is_binary_; }
+
+  template <typename Partial, typename Visitor> std::vector<Partial> scan(Visitor visitor) {
+    std::vector<Partial> partials(num_threads_);
+    std::atomic<size_t> next_chunk(0);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < num_threads_; i++) {
+      workers.emplace_back([this, &partials, &next_chunk, &visitor, i]() {
+        std::vector<TraceRecord> records;
+        for (size_t chunk = next_chunk++; chunk < chunks_.size(); chunk = next_chunk++) {
+          parse_chunk(chunks_[chunk], records);
+          for (auto &record : records) {
+            visitor(partials[i], record);
+          }
+        }
+      });
+    }
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    return partials;
+  }
+
+protected:
+  struct Chunk {
+    size_t begin;
+    size_t end;
+    uint32_t num_records;
+  };
+
+  void index_text();
+  void index_binary();
+
+  void parse_chunk(const Chunk &chunk, std::vector<TraceRecord> &records);
+
+private:
+  static constexpr size_t text_chunk_size_ = 4 << 20;
+
+  MappedFile file_;
+  bool is_binary_;
+  int num_threads_;
+
+  std::vector<Chunk> chunks_;
+};
+
+} // namespace upmem_profiler::basic
+
+#endif
@@ -4,7 +4,7 @@
 
 namespace upmem_profiler::converter {
 
-abi::instruction::OpCode OpCodeConverter::to_op_code(std::string op_code) {
+abi::instruction::OpCode OpCodeConverter::to_op_code(std::string_view op_code) {
   if (op_code == "acquire") {
     return abi::instruction::ACQUIRE;
   } else if (op_code == "release") {
@@ -1,7 +1,7 @@
 #ifndef UPMEM_PROFILER_CONVERTER_OP_CODE_CONVERTER_H_
 #define UPMEM_PROFILER_CONVERTER_OP_CODE_CONVERTER_H_
 
-#include <string>
+#include <string_view>
 
 #include "abi/instruction/op_code.h"
 
@@ -9,7 +9,7 @@ namespace upmem_profiler::converter {
 
 class OpCodeConverter {
 public:
-  static abi::instruction::OpCode to_op_code(std::string op_code);
+  static abi::instruction::OpCode to_op_code(std::string_view op_code);
 };
 
 } // namespace upmem_profiler::converter
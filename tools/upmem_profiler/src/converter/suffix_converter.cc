@@ -4,7 +4,7 @@
 
 namespace upmem_profiler::converter {
 
-abi::instruction::Suffix SuffixConverter::to_suffix(std::string suffix) {
+abi::instruction::Suffix SuffixConverter::to_suffix(std::string_view suffix) {
   if (suffix == "rici") {
     return abi::instruction::RICI;
   } else if (suffix == "rri") {
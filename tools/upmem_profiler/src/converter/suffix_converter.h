@@ -1,7 +1,7 @@
 #ifndef UPMEM_PROFILER_CONVERTER_SUFFIX_CONVERTER_H_
 #define UPMEM_PROFILER_CONVERTER_SUFFIX_CONVERTER_H_
 
-#include <string>
+#include <string_view>
 
 #include "abi/instruction/suffix.h"
 
@@ -9,7 +9,7 @@ namespace upmem_profiler::converter {
 
 class SuffixConverter {
 public:
-  static abi::instruction::Suffix to_suffix(std::string suffix);
+  static abi::instruction::Suffix to_suffix(std::string_view suffix);
 };
 
 } // namespace upmem_profiler::converter
@@ -0,0 +1,210 @@
+#include "hotspot/hotspot_profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+
+#include "abi/instruction/op_code.h"
+#include "abi/instruction/suffix.h"
+#include "util/config_loader.h"
+
+namespace upmem_profiler::hotspot {
+
+void HotspotProfiler::Cost::add(const Cost &cost) {
+  instructions += cost.instructions;
+  cycles += cost.cycles;
+  wait_data += cost.wait_data;
+  wait_schedule += cost.wait_schedule;
+  cycle_rule += cost.cycle_rule;
+}
+
+HotspotProfiler::HotspotProfiler(util::ArgumentParser *argument_parser)
+    : log_file_(argument_parser->get_string_parameter("logpath")),
+      folded_file_(argument_parser->get_string_parameter("foldedpath")),
+      symbol_table_(argument_parser->get_string_parameter("labelpath")) {}
+
+void HotspotProfiler::profile() {
+  // a single worker keeps the records of each thread in trace order
+  basic::TraceScanner trace_scanner(log_file_, 1);
+  if (not trace_scanner.is_binary()) {
+    throw std::invalid_argument("");
+  }
+
+  std::map<std::tuple<int, int>, ThreadState> states;
+  trace_scanner.scan<int>([this, &states](int &, const basic::TraceRecord &record) {
+    ThreadState &state = states[{record.dpu_id, record.thread_id}];
+    if (state.has_last) {
+      Cost cost{1, static_cast<int64_t>(record.cycle - state.last.cycle), record.wait_data_cycles,
+                record.wait_schedule_cycles, record.cycle_rule_cycles};
+      charge(state, state.last, cost);
+      follow_call(state, state.last);
+    } else {
+      state.root = node(-1, intern("tasklet_" + std::to_string(record.thread_id)));
+    }
+
+    state.has_last = true;
+    state.last = record;
+  });
+
+  for (auto &[key, state] : states) {
+    if (state.has_last) {
+      charge(state, state.last, Cost{1, 1});
+    }
+  }
+
+  print_pcs();
+  print_symbols();
+  print_call_graph();
+  write_folded_stacks();
+}
+
+int HotspotProfiler::intern(std::string name) {
+  auto [it, inserted] = symbol_ids_.try_emplace(name, static_cast<int>(symbols_.size()));
+  if (inserted) {
+    symbols_.push_back(name);
+  }
+  return it->second;
+}
+
+int HotspotProfiler::symbol(Address pc) {
+  auto it = pc_symbols_.find(pc);
+  if (it == pc_symbols_.end()) {
+    it = pc_symbols_.emplace(pc, intern(symbol_table_.lookup(pc))).first;
+  }
+  return it->second;
+}
+
+int HotspotProfiler::node(int parent, int symbol) {
+  auto [it, inserted] = children_.try_emplace({parent, symbol}, static_cast<int>(nodes_.size()));
+  if (inserted) {
+    nodes_.push_back({parent, symbol, Cost{}});
+  }
+  return it->second;
+}
+
+void HotspotProfiler::charge(ThreadState &state, const basic::TraceRecord &record, Cost cost) {
+  int context = state.frames.empty() ? state.root : std::get<0>(state.frames.back());
+  int leaf = node(context, symbol(record.pc));
+
+  nodes_[leaf].cost.add(cost);
+  pc_costs_[record.pc].add(cost);
+}
+
+void HotspotProfiler::follow_call(ThreadState &state, const basic::TraceRecord &record) {
+  if (record.op_code != abi::instruction::CALL) {
+    return;
+  }
+
+  Address target = record.ra + (record.operand_mask & basic::TraceRecord::IMM ? record.imm : record.rb);
+  if (record.suffix == abi::instruction::ZRI or record.suffix == abi::instruction::ZRR) {
+    // a jump; it returns if it lands on the innermost return address
+    if (not state.frames.empty() and std::get<1>(state.frames.back()) == target) {
+      state.frames.pop_back();
+    }
+  } else {
+    int context = state.frames.empty() ? state.root : std::get<0>(state.frames.back());
+    int caller = node(context, symbol(record.pc));
+    state.frames.push_back({caller, record.pc + util::ConfigLoader::instruction_size()});
+
+    num_calls_[{state.root, symbol(target)}]++;
+  }
+}
+
+void HotspotProfiler::print_pcs() {
+  std::vector<std::pair<Address, Cost>> pc_costs(pc_costs_.begin(), pc_costs_.end());
+  std::stable_sort(pc_costs.begin(), pc_costs.end(),
+                   [](const auto &lhs, const auto &rhs) { return lhs.second.cycles > rhs.second.cycles; });
+
+  std::cout << "HOTSPOT_PC: " << std::endl;
+  std::cout << "pc,symbol,instructions,cycles,wait_data,wait_schedule,cycle_rule" << std::endl;
+  for (auto &[pc, cost] : pc_costs) {
+    std::cout << pc << "," << symbols_[symbol(pc)] << "," << cost.instructions << "," << cost.cycles << ","
+              << cost.wait_data << "," << cost.wait_schedule << "," << cost.cycle_rule << std::endl;
+  }
+}
+
+void HotspotProfiler::print_symbols() {
+  std::map<int, Cost> symbol_costs;
+  for (auto &[pc, cost] : pc_costs_) {
+    symbol_costs[symbol(pc)].add(cost);
+  }
+
+  std::vector<std::pair<int, Cost>> sorted_costs(symbol_costs.begin(), symbol_costs.end());
+  std::stable_sort(sorted_costs.begin(), sorted_costs.end(),
+                   [](const auto &lhs, const auto &rhs) { return lhs.second.cycles > rhs.second.cycles; });
+
+  std::cout << "HOTSPOT_SYMBOL: " << std::endl;
+  std::cout << "symbol,instructions,cycles,wait_data,wait_schedule,cycle_rule" << std::endl;
+  for (auto &[symbol, cost] : sorted_costs) {
+    std::cout << symbols_[symbol] << "," << cost.instructions << "," << cost.cycles << "," << cost.wait_data << ","
+              << cost.wait_schedule << "," << cost.cycle_rule << std::endl;
+  }
+}
+
+void HotspotProfiler::print_call_graph() {
+  // (tasklet root, symbol) -> cost
+  std::map<std::tuple<int, int>, Cost> exclusive;
+  std::map<std::tuple<int, int>, Cost> inclusive;
+  for (auto &leaf : nodes_) {
+    if (leaf.parent == -1) {
+      continue;
+    }
+
+    std::set<int> path_symbols;
+    int root = leaf.parent;
+    for (int id = leaf.parent; id != -1; id = nodes_[id].parent) {
+      if (nodes_[id].parent != -1) {
+        path_symbols.insert(nodes_[id].symbol);
+      }
+      root = id;
+    }
+    path_symbols.insert(leaf.symbol);
+
+    exclusive[{root, leaf.symbol}].add(leaf.cost);
+    for (auto &symbol : path_symbols) {
+      inclusive[{root, symbol}].add(leaf.cost);
+    }
+  }
+
+  std::cout << "CALL_GRAPH: " << std::endl;
+  std::cout << "tasklet,symbol,calls,exclusive_instructions,exclusive_cycles,inclusive_instructions,inclusive_cycles"
+            << std::endl;
+  for (auto &[key, inclusive_cost] : inclusive) {
+    auto [root, symbol] = key;
+    Cost &exclusive_cost = exclusive[key];
+    std::cout << symbols_[nodes_[root].symbol] << "," << symbols_[symbol] << "," << num_calls_[key] << ","
+              << exclusive_cost.instructions << "," << exclusive_cost.cycles << "," << inclusive_cost.instructions
+              << "," << inclusive_cost.cycles << std::endl;
+  }
+}
+
+void HotspotProfiler::write_folded_stacks() {
+  if (folded_file_.empty()) {
+    return;
+  }
+
+  // one "root;caller;...;leaf cycles" line per calling context
+  std::ofstream ofs(folded_file_);
+  for (auto &leaf : nodes_) {
+    if (leaf.cost.cycles == 0) {
+      continue;
+    }
+
+    std::vector<int> path;
+    for (const Node *node = &leaf;; node = &nodes_[node->parent]) {
+      path.push_back(node->symbol);
+      if (node->parent == -1) {
+        break;
+      }
+    }
+
+    for (auto it = path.rbegin(); it != path.rend(); it++) {
+      ofs << (it == path.rbegin() ? "" : ";") << symbols_[*it];
+    }
+    ofs << " " << leaf.cost.cycles << std::endl;
+  }
+}
+
+} // namespace upmem_profiler::hotspot
@@ -0,0 +1,82 @@
+#ifndef UPMEM_PROFILER_HOTSPOT_HOTSPOT_PROFILER_H_
+#define UPMEM_PROFILER_HOTSPOT_HOTSPOT_PROFILER_H_
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "basic/symbol_table.h"
+#include "basic/trace_scanner.h"
+#include "main.h"
+#include "util/argument_parser.h"
+
+namespace upmem_profiler::hotspot {
+
+// Attributes instructions, cycles and stalls to PCs, symbols and calling contexts. The cycles of an instruction run
+// from its issue to the next issue of the same thread; the stalls a record carries are charged to the previous
+// instruction of that thread, which is what the thread was waiting on. Needs a binary trace.
+class HotspotProfiler {
+public:
+  explicit HotspotProfiler(util::ArgumentParser *argument_parser);
+  ~HotspotProfiler() = default;
+
+  void profile();
+
+protected:
+  struct Cost {
+    int64_t instructions = 0;
+    int64_t cycles = 0;
+    int64_t wait_data = 0;
+    int64_t wait_schedule = 0;
+    int64_t cycle_rule = 0;
+
+    void add(const Cost &cost);
+  };
+
+  // calling context tree; the root of each tasklet has parent -1
+  struct Node {
+    int parent;
+    int symbol;
+    Cost cost;
+  };
+
+  struct ThreadState {
+    bool has_last = false;
+    basic::TraceRecord last;
+    int root;
+    // (caller context, return address)
+    std::vector<std::tuple<int, Address>> frames;
+  };
+
+  int intern(std::string name);
+  int symbol(Address pc);
+  int node(int parent, int symbol);
+
+  void charge(ThreadState &state, const basic::TraceRecord &record, Cost cost);
+  void follow_call(ThreadState &state, const basic::TraceRecord &record);
+
+  void print_pcs();
+  void print_symbols();
+  void print_call_graph();
+  void write_folded_stacks();
+
+private:
+  std::string log_file_;
+  std::string folded_file_;
+  basic::SymbolTable symbol_table_;
+
+  std::vector<std::string> symbols_;
+  std::unordered_map<std::string, int> symbol_ids_;
+  std::unordered_map<Address, int> pc_symbols_;
+
+  std::map<Address, Cost> pc_costs_;
+  std::vector<Node> nodes_;
+  std::map<std::tuple<int, int>, int> children_;
+  std::map<std::tuple<int, int>, int64_t> num_calls_;
+};
+
+} // namespace upmem_profiler::hotspot
+
+#endif
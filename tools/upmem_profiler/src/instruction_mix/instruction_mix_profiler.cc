@@ -1,31 +1,25 @@
 #include "instruction_mix/instruction_mix_profiler.h"
 
+#include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iostream>
+#include <numeric>
 
-#include "basic/instruction_parser.h"
+#include "basic/trace_scanner.h"
 
 namespace upmem_profiler::instruciton_mix {
 
-InstructionMixProfiler::InstructionMixProfiler(util::ArgumentParser *argument_parser) {
-  std::string log_file = argument_parser->get_string_parameter("logpath");
-  instructions_.resize(argument_parser->get_int_parameter("num_tasklets"));
-
-  total_inst_cnt_ = 0;
-
-  std::ifstream ifs(log_file);
-  std::string line;
-  while (std::getline(ifs, line)) {
-    if (basic::InstructionParser::is_instruction(line)) {
-      ThreadID thread_id = basic::InstructionParser::parse_thread_id(line);
-      abi::instruction::OpCode op_code = basic::InstructionParser::parse_op_code(line);
-      abi::instruction::Suffix suffix = basic::InstructionParser::parse_suffix(line);
-
-      instructions_[thread_id].push_back({op_code, suffix});
-      total_inst_cnt_++;
-    }
-
+InstructionMixProfiler::InstructionMixProfiler(util::ArgumentParser *argument_parser)
+    : log_file_(argument_parser->get_string_parameter("logpath")),
+      num_tasklets_(static_cast<int>(argument_parser->get_int_parameter("num_tasklets"))),
+      num_threads_(static_cast<int>(argument_parser->get_int_parameter("num_threads"))),
+      pc_range_size_(argument_parser->get_int_parameter("pc_range_size")),
+      format_(argument_parser->get_string_parameter("format")) {
+  assert(num_tasklets_ > 0);
+  assert(pc_range_size_ >= 0);
+
+  for (auto &suffix_mix_ids : mix_ids_) {
+    suffix_mix_ids.fill(-1);
   }
 
   register_mix("synchronization", abi::instruction::ACQUIRE, abi::instruction::RICI);
@@ -1082,54 +1076,165 @@ void InstructionMixProfiler::register_mix(std::string mix, abi::instruction::OpC
                                           abi::instruction::Suffix suffix) {
   assert(mix != "etc");
 
-  mixes_[mix].insert({op_code, suffix});
+  auto it = std::find(mixes_.begin(), mixes_.end(), mix);
+  auto mix_id = static_cast<int>(it - mixes_.begin());
+  if (it == mixes_.end()) {
+    mixes_.push_back(mix);
+  }
+
+  assert(mix_ids_[op_code][suffix] == -1 or mix_ids_[op_code][suffix] == mix_id);
+  mix_ids_[op_code][suffix] = mix_id;
+}
+
+int InstructionMixProfiler::classify(const basic::TraceRecord &record) {
+  if (record.op_code >= num_op_codes_ or record.suffix >= num_suffixes_) {
+    return -1;
+  }
+  return mix_ids_[record.op_code][record.suffix];
 }
 
 void InstructionMixProfiler::profile() {
-  std::vector<std::map<std::string, int64_t>> instruction_mixes;
-  //auto dbg = instructions_;
-  instruction_mixes.resize(instructions_.size());
-  for (ThreadID thread_id = 0; thread_id < instructions_.size(); thread_id++) {
-    uint64_t non_etc_count = 0;
-    for (auto &[op_code, suffix] : instructions_[thread_id]) {
-      bool dbg_flag = false;
-      for (auto &[mix, mix_specs] : mixes_) {
-        for (auto &mix_spec : mix_specs) {
-          auto [mix_op_code, mix_suffix] = mix_spec;
-          if (op_code == mix_op_code and suffix == mix_suffix) {
-            instruction_mixes[thread_id][mix]++;
-            non_etc_count++;
-            dbg_flag = true;
-          }
-        }
-        //instruction_mixes[thread_id]["etc"] = instructions_[thread_id].size() - non_etc_count;
+  int num_mixes = etc_id() + 1;
+
+  basic::TraceScanner trace_scanner(log_file_, num_threads_);
+  // text logs carry no PC, so every instruction would land in range 0
+  if (pc_range_size_ > 0 and not trace_scanner.is_binary()) {
+    std::cerr << "pc_range_size needs a binary trace; " << log_file_ << " is a text log" << std::endl;
+    throw std::invalid_argument("");
+  }
+
+  std::vector<Partial> partials = trace_scanner.scan<Partial>([&](Partial &partial, const basic::TraceRecord &record) {
+    if (partial.tasklets.empty()) {
+      partial.tasklets.assign(num_tasklets_, MixCounts(num_mixes, 0));
+    }
+    assert(record.thread_id < num_tasklets_);
+
+    int mix_id = classify(record);
+    if (mix_id < 0) {
+      mix_id = etc_id();
+      partial.unclassified[{record.op_code, record.suffix}]++;
+    }
+
+    partial.tasklets[record.thread_id][mix_id]++;
+    if (pc_range_size_ > 0) {
+      MixCounts &pc_range = partial.pc_ranges[record.pc / pc_range_size_ * pc_range_size_];
+      if (pc_range.empty()) {
+        pc_range.resize(num_mixes, 0);
       }
-      if (dbg_flag == false) {
-        std::cout << op_code << " " << suffix << std::endl;
+      pc_range[mix_id]++;
+    }
+  });
+
+  Partial merged;
+  merged.tasklets.assign(num_tasklets_, MixCounts(num_mixes, 0));
+  for (auto &partial : partials) {
+    for (ThreadID thread_id = 0; thread_id < partial.tasklets.size(); thread_id++) {
+      for (int mix_id = 0; mix_id < num_mixes; mix_id++) {
+        merged.tasklets[thread_id][mix_id] += partial.tasklets[thread_id][mix_id];
+      }
+    }
+    for (auto &[pc_range, counts] : partial.pc_ranges) {
+      MixCounts &merged_counts = merged.pc_ranges[pc_range];
+      merged_counts.resize(num_mixes, 0);
+      for (int mix_id = 0; mix_id < num_mixes; mix_id++) {
+        merged_counts[mix_id] += counts[mix_id];
       }
     }
-    instruction_mixes[thread_id]["etc"] = instructions_[thread_id].size() - non_etc_count;
+    for (auto &[spec, count] : partial.unclassified) {
+      merged.unclassified[spec] += count;
+    }
   }
 
-  // for (ThreadID thread_id = 0; thread_id < instruction_mixes.size(); thread_id++) {
-  //   std::cout << "ThreadID: " << thread_id << std::endl;
+  for (auto &[spec, count] : merged.unclassified) {
+    auto [op_code, suffix] = spec;
+    std::cerr << "unclassified " << op_code << " " << suffix << ": " << count << std::endl;
+  }
 
-  //   for (auto &[mix, count] : instruction_mixes[thread_id]) {
-  //     std::cout << thread_id  << "_" <<mix << ": " << count << std::endl;
-  //   }
+  if (format_ == "text") {
+    print_text(merged);
+  } else if (format_ == "csv") {
+    print_csv(merged);
+  } else if (format_ == "json") {
+    print_json(merged);
+  } else {
+    throw std::invalid_argument("");
+  }
+}
+
+InstructionMixProfiler::MixCounts InstructionMixProfiler::total(const Partial &merged) {
+  MixCounts totals(etc_id() + 1, 0);
+  for (auto &counts : merged.tasklets) {
+    for (int mix_id = 0; mix_id <= etc_id(); mix_id++) {
+      totals[mix_id] += counts[mix_id];
+    }
+  }
+  return totals;
+}
 
-  //   std::cout << std::endl;
-  // }
+void InstructionMixProfiler::print_text(const Partial &merged) {
+  MixCounts totals = total(merged);
+  int64_t total_inst_cnt = std::accumulate(totals.begin(), totals.end(), int64_t{0});
 
   std::cout << "INSTRUCTION_MIX: " << std::endl;
 
   for (auto &type_ : inst_type_) {
-    uint64_t cnt_inst = 0;
-    for (ThreadID thread_id = 0; thread_id < instruction_mixes.size(); thread_id++) { 
-      cnt_inst += instruction_mixes[thread_id][type_];
+    auto it = std::find(mixes_.begin(), mixes_.end(), type_);
+    int64_t cnt_inst = it == mixes_.end() ? 0 : totals[it - mixes_.begin()];
+    std::cout << type_ << "," << ((double)cnt_inst / (double)total_inst_cnt) << std::endl;
+  }
+}
+
+void InstructionMixProfiler::print_csv(const Partial &merged) {
+  auto print_rows = [this](std::string scope, std::string key, const MixCounts &counts) {
+    for (int mix_id = 0; mix_id <= etc_id(); mix_id++) {
+      std::string mix = mix_id == etc_id() ? "etc" : mixes_[mix_id];
+      std::cout << scope << "," << key << "," << mix << "," << counts[mix_id] << std::endl;
     }
-    std::cout << type_ << "," << ((double)cnt_inst / (double)total_inst_cnt_) << std::endl;
+  };
+
+  MixCounts totals = total(merged);
+
+  std::cout << "scope,key,mix,count" << std::endl;
+  print_rows("total", "", totals);
+  for (ThreadID thread_id = 0; thread_id < merged.tasklets.size(); thread_id++) {
+    print_rows("tasklet", std::to_string(thread_id), merged.tasklets[thread_id]);
+  }
+  for (auto &[pc_range, counts] : merged.pc_ranges) {
+    print_rows("pc_range", std::to_string(pc_range), counts);
+  }
+}
+
+void InstructionMixProfiler::print_json(const Partial &merged) {
+  auto print_counts = [this](const MixCounts &counts) {
+    std::cout << "{";
+    for (int mix_id = 0; mix_id <= etc_id(); mix_id++) {
+      std::string mix = mix_id == etc_id() ? "etc" : mixes_[mix_id];
+      std::cout << (mix_id == 0 ? "" : ", ") << "\"" << mix << "\": " << counts[mix_id];
+    }
+    std::cout << "}";
+  };
+
+  MixCounts totals = total(merged);
+
+  std::cout << "{\n  \"total\": ";
+  print_counts(totals);
+
+  std::cout << ",\n  \"tasklets\": [";
+  for (ThreadID thread_id = 0; thread_id < merged.tasklets.size(); thread_id++) {
+    std::cout << (thread_id == 0 ? "\n    " : ",\n    ");
+    print_counts(merged.tasklets[thread_id]);
+  }
+
+  std::cout << "\n  ],\n  \"pc_ranges\": [";
+  bool first = true;
+  for (auto &[pc_range, counts] : merged.pc_ranges) {
+    std::cout << (first ? "\n    " : ",\n    ") << "{\"begin\": " << pc_range
+              << ", \"end\": " << pc_range + pc_range_size_ << ", \"mixes\": ";
+    print_counts(counts);
+    std::cout << "}";
+    first = false;
   }
+  std::cout << "\n  ]\n}" << std::endl;
 }
 
 } // namespace upmem_profiler::instruciton_mix
@@ -1,14 +1,15 @@
 #ifndef UPMEM_PROFILER_INSTRUCTION_MIX_INSTRUCTION_MIX_PROFILER_H_
 #define UPMEM_PROFILER_INSTRUCTION_MIX_INSTRUCTION_MIX_PROFILER_H_
 
+#include <array>
 #include <map>
-#include <set>
 #include <string>
-#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "abi/instruction/op_code.h"
 #include "abi/instruction/suffix.h"
+#include "basic/trace_scanner.h"
 #include "main.h"
 #include "util/argument_parser.h"
 
@@ -23,13 +24,41 @@ public:
 
   void profile();
 
+protected:
+  static constexpr int num_op_codes_ = abi::instruction::SDMA + 1;
+  static constexpr int num_suffixes_ = abi::instruction::DMA_RRI + 1;
+
+  // instruction counts per mix; the last column counts "etc"
+  using MixCounts = std::vector<int64_t>;
+
+  struct Partial {
+    std::vector<MixCounts> tasklets;
+    std::map<Address, MixCounts> pc_ranges;
+    std::map<std::pair<int, int>, int64_t> unclassified;
+  };
+
+  int etc_id() { return static_cast<int>(mixes_.size()); }
+  int classify(const basic::TraceRecord &record);
+
+  MixCounts total(const Partial &merged);
+
+  void print_text(const Partial &merged);
+  void print_csv(const Partial &merged);
+  void print_json(const Partial &merged);
+
 private:
-  std::map<std::string, std::set<std::tuple<abi::instruction::OpCode, abi::instruction::Suffix>>> mixes_;
-  std::vector<std::vector<std::tuple<abi::instruction::OpCode, abi::instruction::Suffix>>> instructions_;
+  std::string log_file_;
+  int num_tasklets_;
+  int num_threads_;
+  Address pc_range_size_;
+  std::string format_;
+
+  std::vector<std::string> mixes_;
+  // mix id per (op code, suffix); -1 if the pair belongs to no mix
+  std::array<std::array<int, num_suffixes_>, num_op_codes_> mix_ids_;
+
   std::vector<std::string> inst_type_{"arithmetic", "arithmetic_and_cond_branch", "heavy_arithmetic", "heavy_arithmetic_and_cond_branch",
     "system", "system_and_cond_branch", "call", "reg_move_and_cond_branch", "scratchpad_access", "mainmemory_access", "synchronization"};
-  
-  uint64_t total_inst_cnt_;
 };
 
 } // namespace upmem_profiler::instruciton_mix
@@ -1,6 +1,8 @@
 #include <iostream>
 
+#include "hotspot/hotspot_profiler.h"
 #include "instruction_mix/instruction_mix_profiler.h"
+#include "mram_locality/mram_locality_profiler.h"
 #include "util/argument_parser.h"
 
 namespace upmem_profiler {
@@ -10,9 +12,24 @@ util::ArgumentParser *init_argument_parser() {
 
   argument_parser->add_option("mode", util::ArgumentParser::STRING, "instruction_mix");
 
+  // hotspot: "name: address" labels of the profiled binary
   argument_parser->add_option("labelpath", util::ArgumentParser::STRING, "/home/dongjaelee/upmem_profiler/bin/1024/VA.16/labels.bin");
   argument_parser->add_option("logpath", util::ArgumentParser::STRING, "/home/dongjae/data_sweep_hbm_mmu/trace/ptw1_tlbway16_tlbset1/VA/131072/VA.16.trace");
   argument_parser->add_option("num_tasklets", util::ArgumentParser::INT, "16");
+  // parser threads; 0 uses every hardware thread
+  argument_parser->add_option("num_threads", util::ArgumentParser::INT, "0");
+
+  // instruction_mix: text (totals only), csv or json; pc_range_size > 0 adds per-PC-range breakdowns (binary
+  // traces only, text logs carry no PC)
+  argument_parser->add_option("format", util::ArgumentParser::STRING, "text");
+  argument_parser->add_option("pc_range_size", util::ArgumentParser::INT, "0");
+
+  // hotspot: folded stacks for flame graphs are written here when set
+  argument_parser->add_option("foldedpath", util::ArgumentParser::STRING, "");
+
+  // mram_locality: logpath is a simulator access log; reuse distances count distinct blocks of reuse_block_size bytes
+  argument_parser->add_option("reuse_block_size", util::ArgumentParser::INT, "8");
+  argument_parser->add_option("wordline_sizes", util::ArgumentParser::STRING, "512,1024,2048,4096");
 
   return argument_parser;
 }
@@ -28,6 +45,14 @@ int main(int argc, char **argv) {
     auto instruction_mix_profiler = new upmem_profiler::instruciton_mix::InstructionMixProfiler(argument_parser);
     instruction_mix_profiler->profile();
     delete instruction_mix_profiler;
+  } else if (mode == "hotspot") {
+    auto hotspot_profiler = new upmem_profiler::hotspot::HotspotProfiler(argument_parser);
+    hotspot_profiler->profile();
+    delete hotspot_profiler;
+  } else if (mode == "mram_locality") {
+    auto mram_locality_profiler = new upmem_profiler::mram_locality::MRAMLocalityProfiler(argument_parser);
+    mram_locality_profiler->profile();
+    delete mram_locality_profiler;
   } else {
     throw std::invalid_argument("");
   }
@@ -0,0 +1,315 @@
+#include "mram_locality/mram_locality_profiler.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#include "util/config_loader.h"
+
+namespace upmem_profiler::mram_locality {
+
+MRAMLocalityProfiler::MRAMLocalityProfiler(util::ArgumentParser *argument_parser)
+    : log_file_(argument_parser->get_string_parameter("logpath")),
+      num_tasklets_(static_cast<int>(argument_parser->get_int_parameter("num_tasklets"))),
+      reuse_block_size_(argument_parser->get_int_parameter("reuse_block_size")) {
+  assert(num_tasklets_ > 0);
+  assert(reuse_block_size_ > 0);
+
+  std::istringstream iss(argument_parser->get_string_parameter("wordline_sizes"));
+  std::string wordline_size;
+  while (std::getline(iss, wordline_size, ',')) {
+    wordline_sizes_.push_back(std::stoll(wordline_size));
+    if (wordline_sizes_.back() <= 0 or wordline_sizes_.back() % util::ConfigLoader::min_access_granularity() != 0) {
+      throw std::invalid_argument("");
+    }
+  }
+}
+
+void MRAMLocalityProfiler::profile() {
+  read_log();
+
+  print_accesses();
+  print_reuse_distances();
+  print_strides();
+  print_row_buffer();
+}
+
+bool MRAMLocalityProfiler::parse_dma(std::string_view line, int &dpu_id, DMAAccess &access) {
+  // cycle,dpu_id,event,thread_id,address,size,mram_address
+  std::string_view fields[7];
+  for (auto &field : fields) {
+    size_t comma_pos = line.find(',');
+    field = line.substr(0, comma_pos);
+    line.remove_prefix(comma_pos == std::string_view::npos ? line.size() : comma_pos + 1);
+  }
+
+  if (fields[2] != "ldma" and fields[2] != "sdma") {
+    return false;
+  }
+
+  auto parse = [](std::string_view field, auto &value) {
+    if (std::from_chars(field.data(), field.data() + field.size(), value).ec != std::errc()) {
+      throw std::invalid_argument("");
+    }
+  };
+  parse(fields[1], dpu_id);
+  parse(fields[3], access.tasklet);
+  parse(fields[5], access.size);
+  parse(fields[6], access.mram_address);
+  access.is_write = fields[2] == "sdma";
+  return true;
+}
+
+MRAMLocalityProfiler::Segments MRAMLocalityProfiler::segments(const DMAAccess &access, Address wordline_size) {
+  Address min_access_granularity = util::ConfigLoader::min_access_granularity();
+
+  Segments segments;
+  Address address = access.mram_address;
+  Address end_address = access.mram_address + access.size;
+  while (address < end_address) {
+    Address row = address / wordline_size;
+    Address size = std::min((row + 1) * wordline_size, end_address) - address;
+    segments.push_back({row, (size + min_access_granularity - 1) / min_access_granularity});
+    address += size;
+  }
+  return segments;
+}
+
+void MRAMLocalityProfiler::read_log() {
+  // gzread also passes uncompressed logs through
+  gzFile file = gzopen(log_file_.c_str(), "rb");
+  if (file == nullptr) {
+    throw std::invalid_argument("");
+  }
+
+  char buffer[256];
+  while (gzgets(file, buffer, sizeof(buffer)) != nullptr) {
+    std::string_view line(buffer);
+    if (not line.empty() and line.back() == '\n') {
+      line.remove_suffix(1);
+    }
+
+    int dpu_id;
+    DMAAccess access;
+    if (line.substr(0, 5) != "cycle" and parse_dma(line, dpu_id, access)) {
+      dpus_[dpu_id].push_back(access);
+    }
+  }
+  gzclose(file);
+}
+
+void MRAMLocalityProfiler::print_accesses() {
+  std::cout << "MRAM_ACCESS: " << std::endl;
+  std::cout << "dpu,tasklet,dma_commands,read_bytes,write_bytes" << std::endl;
+  for (auto &[dpu_id, accesses] : dpus_) {
+    std::map<int, std::array<int64_t, 3>> tasklets;
+    for (auto &access : accesses) {
+      auto &counts = tasklets[access.tasklet];
+      counts[0]++;
+      counts[access.is_write ? 2 : 1] += access.size;
+    }
+
+    for (auto &[tasklet, counts] : tasklets) {
+      std::cout << dpu_id << "," << tasklet << "," << counts[0] << "," << counts[1] << "," << counts[2] << std::endl;
+    }
+  }
+}
+
+void MRAMLocalityProfiler::print_reuse_distances() {
+  std::cout << "REUSE_DISTANCE: " << std::endl;
+  std::cout << "scope,dpu,tasklet,distance,count" << std::endl;
+  for (auto &[dpu_id, accesses] : dpus_) {
+    auto num_blocks = [this](const DMAAccess &access) {
+      return access.size == 0 ? 0
+                              : (access.mram_address + access.size - 1) / reuse_block_size_ -
+                                    access.mram_address / reuse_block_size_ + 1;
+    };
+
+    int64_t num_accesses = 0;
+    std::map<int, int64_t> num_tasklet_accesses;
+    for (auto &access : accesses) {
+      num_accesses += num_blocks(access);
+      num_tasklet_accesses[access.tasklet] += num_blocks(access);
+    }
+
+    ReuseDistance dpu_reuse_distance(num_accesses);
+    std::map<int, ReuseDistance> tasklet_reuse_distances;
+    for (auto &[tasklet, num_blocks] : num_tasklet_accesses) {
+      tasklet_reuse_distances.emplace(tasklet, num_blocks);
+    }
+
+    for (auto &access : accesses) {
+      ReuseDistance &tasklet_reuse_distance = tasklet_reuse_distances.at(access.tasklet);
+      Address begin_block = access.mram_address / reuse_block_size_;
+      for (int64_t i = 0; i < num_blocks(access); i++) {
+        dpu_reuse_distance.access(begin_block + i);
+        tasklet_reuse_distance.access(begin_block + i);
+      }
+    }
+
+    print_histogram("dpu", dpu_id, "", dpu_reuse_distance);
+    for (auto &[tasklet, reuse_distance] : tasklet_reuse_distances) {
+      print_histogram("tasklet", dpu_id, std::to_string(tasklet), reuse_distance);
+    }
+  }
+}
+
+void MRAMLocalityProfiler::print_histogram(std::string scope, int dpu_id, std::string tasklet,
+                                           ReuseDistance &reuse_distance) {
+  std::cout << scope << "," << dpu_id << "," << tasklet << ",cold," << reuse_distance.num_cold() << std::endl;
+
+  const std::vector<int64_t> &histogram = reuse_distance.histogram();
+  for (int bucket = 0; bucket < static_cast<int>(histogram.size()); bucket++) {
+    std::cout << scope << "," << dpu_id << "," << tasklet << ",";
+    if (bucket <= 1) {
+      std::cout << bucket;
+    } else {
+      std::cout << (int64_t{1} << (bucket - 1)) << "-" << (int64_t{1} << bucket) - 1;
+    }
+    std::cout << "," << histogram[bucket] << std::endl;
+  }
+}
+
+void MRAMLocalityProfiler::print_strides() {
+  // the four most frequent strides between consecutive DMA commands of a tasklet
+  std::cout << "STRIDE: " << std::endl;
+  std::cout << "dpu,tasklet,stride,count,fraction" << std::endl;
+  for (auto &[dpu_id, accesses] : dpus_) {
+    std::map<int, Address> last_addresses;
+    std::map<int, std::map<int64_t, int64_t>> tasklet_strides;
+    for (auto &access : accesses) {
+      auto [it, inserted] = last_addresses.try_emplace(access.tasklet, access.mram_address);
+      if (not inserted) {
+        tasklet_strides[access.tasklet][static_cast<int64_t>(access.mram_address - it->second)]++;
+        it->second = access.mram_address;
+      }
+    }
+
+    for (auto &[tasklet, strides] : tasklet_strides) {
+      std::vector<std::pair<int64_t, int64_t>> sorted_strides(strides.begin(), strides.end());
+      std::stable_sort(sorted_strides.begin(), sorted_strides.end(),
+                       [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+
+      int64_t total = 0;
+      for (auto &[stride, count] : sorted_strides) {
+        total += count;
+      }
+
+      for (int i = 0; i < std::min(4, static_cast<int>(sorted_strides.size())); i++) {
+        auto [stride, count] = sorted_strides[i];
+        std::cout << dpu_id << "," << tasklet << "," << stride << "," << count << "," << std::fixed
+                  << std::setprecision(4) << static_cast<double>(count) / total << std::defaultfloat << std::endl;
+      }
+    }
+  }
+}
+
+void MRAMLocalityProfiler::print_row_buffer() {
+  std::cout << "ROW_BUFFER: " << std::endl;
+  std::cout << "dpu,wordline_size,policy,accesses,hits,hit_rate" << std::endl;
+  for (auto &[dpu_id, accesses] : dpus_) {
+    for (auto &wordline_size : wordline_sizes_) {
+      std::pair<std::string, RowBufferHits> policies[] = {{"fifo", fifo(accesses, wordline_size)},
+                                                          {"frfcfs", frfcfs(accesses, wordline_size)},
+                                                          {"ideal", ideal(accesses, wordline_size)}};
+      for (auto &[policy, row_buffer_hits] : policies) {
+        double hit_rate = row_buffer_hits.accesses == 0
+                              ? 0.0
+                              : static_cast<double>(row_buffer_hits.hits) / row_buffer_hits.accesses;
+        std::cout << dpu_id << "," << wordline_size << "," << policy << "," << row_buffer_hits.accesses << ","
+                  << row_buffer_hits.hits << "," << std::fixed << std::setprecision(4) << hit_rate
+                  << std::defaultfloat << std::endl;
+      }
+    }
+  }
+}
+
+MRAMLocalityProfiler::RowBufferHits MRAMLocalityProfiler::fifo(const std::vector<DMAAccess> &accesses,
+                                                               Address wordline_size) {
+  RowBufferHits row_buffer_hits;
+  Address open_row = -1;
+  for (auto &access : accesses) {
+    for (auto &[row, num_accesses] : segments(access, wordline_size)) {
+      row_buffer_hits.accesses += num_accesses;
+      row_buffer_hits.hits += row == open_row ? num_accesses : num_accesses - 1;
+      open_row = row;
+    }
+  }
+  return row_buffer_hits;
+}
+
+MRAMLocalityProfiler::RowBufferHits MRAMLocalityProfiler::frfcfs(const std::vector<DMAAccess> &accesses,
+                                                                 Address wordline_size) {
+  // A tasklet blocks on its DMA, so at most num_tasklets commands wait in the reorder buffer. Row hits anywhere in the
+  // buffer go first, otherwise the oldest segment opens its row.
+  struct Pending {
+    int command;
+    Address row;
+    int64_t num_accesses;
+  };
+
+  RowBufferHits row_buffer_hits;
+  Address open_row = -1;
+  std::list<Pending> reorder_buffer;
+  std::vector<int> num_pending_segments(accesses.size(), 0);
+
+  int next_command = 0;
+  int num_commands_in_buffer = 0;
+  while (next_command < static_cast<int>(accesses.size()) or not reorder_buffer.empty()) {
+    while (num_commands_in_buffer < num_tasklets_ and next_command < static_cast<int>(accesses.size())) {
+      for (auto &[row, num_accesses] : segments(accesses[next_command], wordline_size)) {
+        reorder_buffer.push_back({next_command, row, num_accesses});
+        num_pending_segments[next_command]++;
+      }
+      num_commands_in_buffer += num_pending_segments[next_command] > 0 ? 1 : 0;
+      next_command++;
+    }
+
+    if (reorder_buffer.empty()) {
+      continue;
+    }
+
+    auto it = std::find_if(reorder_buffer.begin(), reorder_buffer.end(),
+                           [open_row](const Pending &pending) { return pending.row == open_row; });
+    if (it == reorder_buffer.end()) {
+      it = reorder_buffer.begin();
+      row_buffer_hits.hits += it->num_accesses - 1;
+      open_row = it->row;
+    } else {
+      row_buffer_hits.hits += it->num_accesses;
+    }
+    row_buffer_hits.accesses += it->num_accesses;
+
+    if (--num_pending_segments[it->command] == 0) {
+      num_commands_in_buffer--;
+    }
+    reorder_buffer.erase(it);
+  }
+  return row_buffer_hits;
+}
+
+MRAMLocalityProfiler::RowBufferHits MRAMLocalityProfiler::ideal(const std::vector<DMAAccess> &accesses,
+                                                                Address wordline_size) {
+  // unbounded reordering opens every row exactly once
+  RowBufferHits row_buffer_hits;
+  std::set<Address> rows;
+  for (auto &access : accesses) {
+    for (auto &[row, num_accesses] : segments(access, wordline_size)) {
+      row_buffer_hits.accesses += num_accesses;
+      rows.insert(row);
+    }
+  }
+  row_buffer_hits.hits = row_buffer_hits.accesses - static_cast<int64_t>(rows.size());
+  return row_buffer_hits;
+}
+
+} // namespace upmem_profiler::mram_locality
@@ -0,0 +1,69 @@
+#ifndef UPMEM_PROFILER_MRAM_LOCALITY_MRAM_LOCALITY_PROFILER_H_
+#define UPMEM_PROFILER_MRAM_LOCALITY_MRAM_LOCALITY_PROFILER_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "main.h"
+#include "mram_locality/reuse_distance.h"
+#include "util/argument_parser.h"
+
+namespace upmem_profiler::mram_locality {
+
+// Locality of the DMA stream in a simulator access log (--access_log): reuse distances per DPU and tasklet, strides
+// per tasklet and the row-buffer hit rate each wordline size would reach under fifo, frfcfs and an ideal scheduler.
+class MRAMLocalityProfiler {
+public:
+  explicit MRAMLocalityProfiler(util::ArgumentParser *argument_parser);
+  ~MRAMLocalityProfiler() = default;
+
+  void profile();
+
+protected:
+  struct DMAAccess {
+    int tasklet;
+    bool is_write;
+    Address mram_address;
+    Address size;
+  };
+
+  // (row, min_access_granularity accesses) of one DMA command, split at wordline boundaries like the schedulers do
+  using Segments = std::vector<std::pair<Address, int64_t>>;
+
+  struct RowBufferHits {
+    int64_t accesses = 0;
+    int64_t hits = 0;
+  };
+
+  static bool parse_dma(std::string_view line, int &dpu_id, DMAAccess &access);
+  static Segments segments(const DMAAccess &access, Address wordline_size);
+
+  void read_log();
+
+  void print_accesses();
+  void print_reuse_distances();
+  void print_strides();
+  void print_row_buffer();
+
+  void print_histogram(std::string scope, int dpu_id, std::string tasklet, ReuseDistance &reuse_distance);
+
+  RowBufferHits fifo(const std::vector<DMAAccess> &accesses, Address wordline_size);
+  RowBufferHits frfcfs(const std::vector<DMAAccess> &accesses, Address wordline_size);
+  RowBufferHits ideal(const std::vector<DMAAccess> &accesses, Address wordline_size);
+
+private:
+  std::string log_file_;
+  int num_tasklets_;
+  Address reuse_block_size_;
+  std::vector<Address> wordline_sizes_;
+
+  // DMA commands per DPU in issue order
+  std::map<int, std::vector<DMAAccess>> dpus_;
+};
+
+} // namespace upmem_profiler::mram_locality
+
+#endif
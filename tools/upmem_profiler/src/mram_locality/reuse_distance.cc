@@ -0,0 +1,48 @@
+#include "mram_locality/reuse_distance.h"
+
+#include <cassert>
+
+namespace upmem_profiler::mram_locality {
+
+ReuseDistance::ReuseDistance(int64_t num_accesses) : tree_(num_accesses + 1, 0), time_(0), num_cold_(0) {}
+
+void ReuseDistance::access(Address block) {
+  time_++;
+  assert(time_ < static_cast<int64_t>(tree_.size()));
+
+  auto [it, inserted] = last_accesses_.try_emplace(block, time_);
+  if (inserted) {
+    num_cold_++;
+  } else {
+    int64_t distance = prefix_sum(time_ - 1) - prefix_sum(it->second);
+
+    int bucket = 0;
+    while ((int64_t{1} << bucket) <= distance) {
+      bucket++;
+    }
+    if (bucket >= static_cast<int>(histogram_.size())) {
+      histogram_.resize(bucket + 1, 0);
+    }
+    histogram_[bucket]++;
+
+    update(it->second, -1);
+    it->second = time_;
+  }
+  update(time_, 1);
+}
+
+void ReuseDistance::update(int64_t index, int delta) {
+  for (; index < static_cast<int64_t>(tree_.size()); index += index & -index) {
+    tree_[index] += delta;
+  }
+}
+
+int64_t ReuseDistance::prefix_sum(int64_t index) {
+  int64_t sum = 0;
+  for (; index > 0; index -= index & -index) {
+    sum += tree_[index];
+  }
+  return sum;
+}
+
+} // namespace upmem_profiler::mram_locality
@@ -0,0 +1,40 @@
+#ifndef UPMEM_PROFILER_MRAM_LOCALITY_REUSE_DISTANCE_H_
+#define UPMEM_PROFILER_MRAM_LOCALITY_REUSE_DISTANCE_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "main.h"
+
+namespace upmem_profiler::mram_locality {
+
+// Stack (reuse) distance of a block stream: the number of distinct blocks touched since the previous access to the
+// same block. A Fenwick tree marks the latest access of every block, so each access costs O(log n).
+class ReuseDistance {
+public:
+  explicit ReuseDistance(int64_t num_accesses);
+  ~ReuseDistance() = default;
+
+  void access(Address block);
+
+  // bucket 0 counts distance 0 and bucket i > 0 counts distances in [2^(i-1), 2^i)
+  const std::vector<int64_t> &histogram() { return histogram_; }
+  int64_t num_cold() { return num_cold_; }
+
+protected:
+  void update(int64_t index, int delta);
+  int64_t prefix_sum(int64_t index);
+
+private:
+  std::vector<int> tree_;
+  std::unordered_map<Address, int64_t> last_accesses_;
+  int64_t time_;
+
+  std::vector<int64_t> histogram_;
+  int64_t num_cold_;
+};
+
+} // namespace upmem_profiler::mram_locality
+
+#endif
@@ -1,11 +1,19 @@
 #ifndef UPMEM_PROFILER_UTIL_CONFIG_LOADER_H_
 #define UPMEM_PROFILER_UTIL_CONFIG_LOADER_H_
 
+#include <cstdint>
+
 namespace upmem_profiler::util {
 
 class ConfigLoader {
 public:
   static int num_gp_registers() { return 24; }
+
+  static int64_t iram_offset() { return 384 * 1024; }
+  static int64_t iram_size() { return 48 * 1024; }
+  static int64_t instruction_size() { return 12; }
+
+  static int64_t min_access_granularity() { return 8; }
 };
 
 } // namespace upmem_profiler::util